@@ -0,0 +1,77 @@
+#!/usr/bin/env python3
+"""Polls /api on a running control the way the web page does, from several
+clients at once, and reports what each poll costs.
+
+    api_poll.py <host> [pollers] [seconds]
+
+Each poller sends If-None-Match with the last ETag it got, so polls with no
+alarm changes in between come back as 304. The defaults are 10 pollers for
+10 seconds. Only the Python standard library is used.
+"""
+import http.client
+import sys
+import threading
+import time
+
+
+def poll(host, seconds, results):
+    conn = http.client.HTTPConnection(host, timeout=5)
+    etag = None
+    end = time.monotonic() + seconds
+    while time.monotonic() < end:
+        headers = {"If-None-Match": etag} if etag else {}
+        start = time.monotonic()
+        try:
+            conn.request("GET", "/api", headers=headers)
+            resp = conn.getresponse()
+            body = resp.read()
+        except (OSError, http.client.HTTPException):
+            conn.close()
+            conn = http.client.HTTPConnection(host, timeout=5)
+            results.append((None, 0, 0))
+            continue
+        elapsed = time.monotonic() - start
+        etag = resp.getheader("ETag", etag)
+        # the status line and headers count too
+        size = len(body) + sum(len(k) + len(v) + 4
+                               for k, v in resp.getheaders())
+        results.append((resp.status, size, elapsed))
+    conn.close()
+
+
+def percentile(values, p):
+    return values[min(len(values) - 1, int(len(values) * p / 100))]
+
+
+def main():
+    if len(sys.argv) < 2:
+        print(__doc__)
+        return 1
+    host = sys.argv[1]
+    pollers = int(sys.argv[2]) if len(sys.argv) > 2 else 10
+    seconds = float(sys.argv[3]) if len(sys.argv) > 3 else 10
+    results = []
+    threads = [threading.Thread(target=poll, args=(host, seconds, results))
+               for _ in range(pollers)]
+    for t in threads:
+        t.start()
+    for t in threads:
+        t.join()
+    done = [r for r in results if r[0] is not None]
+    if not done:
+        print("no polls completed")
+        return 1
+    for status in sorted(set(r[0] for r in done)):
+        print("%d: %d polls" % (status, sum(1 for r in done if r[0] == status)))
+    print("failed: %d polls" % (len(results) - len(done)))
+    print("bytes per poll: %.1f" % (sum(r[1] for r in done) / len(done)))
+    times = sorted(r[2] * 1000 for r in done)
+    print("ms per poll p50/p90/p99/max: %.1f/%.1f/%.1f/%.1f" % (
+        percentile(times, 50), percentile(times, 90), percentile(times, 99),
+        times[-1]))
+    print("polls per second: %.1f" % (len(done) / seconds))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
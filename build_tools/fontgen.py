@@ -0,0 +1,461 @@
+#!/usr/bin/env python3
+"""Generates trimmed font headers for the panel UI from a TrueType font.
+
+    fontgen.py subset <input> <output.h> <name> <chars>
+        writes a TrueType font holding only the glyphs for <chars>
+    fontgen.py vlw <input> <output.h> <name> <chars> <size>
+        writes an anti-aliased VLW bitmap font of <chars>, <size> pixels from
+        ascender to descender (the same as tt_font with font_size_units::px)
+
+<input> is a .ttf file or a C header holding one as a byte array, like the
+ones in include/assets. Only the Python standard library is used.
+"""
+import math
+import os
+import re
+import struct
+import sys
+
+
+def read_font_bytes(path):
+    with open(path, "rb") as f:
+        data = f.read()
+    if path.lower().endswith((".h", ".hpp")):
+        text = data.decode("utf-8", "replace")
+        body = text[re.search(r"\[\w*\]\s*=\s*\{", text).end():]
+        body = body[:body.index("}")]
+        return bytes(int(v, 16) for v in re.findall(r"0x([0-9a-fA-F]{2})",
+                                                    body))
+    return data
+
+
+class TrueType:
+    def __init__(self, data):
+        self.data = data
+        num_tables = struct.unpack_from(">H", data, 4)[0]
+        self.tables = {}
+        for i in range(num_tables):
+            tag, _, offset, length = struct.unpack_from(">4sIII", data,
+                                                        12 + i * 16)
+            self.tables[tag.decode("latin-1")] = (offset, length)
+        head = self.table("head")
+        self.units_per_em = struct.unpack_from(">H", head, 18)[0]
+        self.long_loca = struct.unpack_from(">h", head, 50)[0] != 0
+        hhea = self.table("hhea")
+        self.ascender, self.descender = struct.unpack_from(">hh", hhea, 4)
+        self.num_hmetrics = struct.unpack_from(">H", hhea, 34)[0]
+        self.num_glyphs = struct.unpack_from(">H", self.table("maxp"), 4)[0]
+        self.cmap = self._parse_cmap()
+        loca = self.table("loca")
+        if self.long_loca:
+            self.loca = list(struct.unpack_from(">%dI" % (self.num_glyphs + 1),
+                                                loca))
+        else:
+            self.loca = [v * 2 for v in struct.unpack_from(
+                ">%dH" % (self.num_glyphs + 1), loca)]
+        self.glyf = self.table("glyf")
+        self.hmtx = self.table("hmtx")
+
+    def table(self, tag):
+        offset, length = self.tables[tag]
+        return self.data[offset:offset + length]
+
+    def _parse_cmap(self):
+        cmap = self.table("cmap")
+        count = struct.unpack_from(">H", cmap, 2)[0]
+        best = None
+        for i in range(count):
+            platform, encoding, offset = struct.unpack_from(">HHI", cmap,
+                                                            4 + i * 8)
+            fmt = struct.unpack_from(">H", cmap, offset)[0]
+            if fmt == 4 and (platform, encoding) in ((3, 1), (0, 3), (0, 4)):
+                best = offset
+                break
+        if best is None:
+            raise ValueError("no unicode format 4 cmap")
+        seg_count = struct.unpack_from(">H", cmap, best + 6)[0] // 2
+        ends = struct.unpack_from(">%dH" % seg_count, cmap, best + 14)
+        starts_at = best + 16 + seg_count * 2
+        starts = struct.unpack_from(">%dH" % seg_count, cmap, starts_at)
+        deltas = struct.unpack_from(">%dh" % seg_count, cmap,
+                                    starts_at + seg_count * 2)
+        ranges_at = starts_at + seg_count * 4
+        ranges = struct.unpack_from(">%dH" % seg_count, cmap, ranges_at)
+        result = {}
+        for i in range(seg_count):
+            for c in range(starts[i], ends[i] + 1):
+                if c == 0xFFFF:
+                    continue
+                if ranges[i] == 0:
+                    g = (c + deltas[i]) & 0xFFFF
+                else:
+                    at = ranges_at + i * 2 + ranges[i] + (c - starts[i]) * 2
+                    g = struct.unpack_from(">H", cmap, at)[0]
+                    if g != 0:
+                        g = (g + deltas[i]) & 0xFFFF
+                if g != 0:
+                    result[c] = g
+        return result
+
+    def glyph_data(self, g):
+        return self.glyf[self.loca[g]:self.loca[g + 1]]
+
+    def metrics(self, g):
+        if g < self.num_hmetrics:
+            return struct.unpack_from(">Hh", self.hmtx, g * 4)
+        advance = struct.unpack_from(">H", self.hmtx,
+                                     (self.num_hmetrics - 1) * 4)[0]
+        lsb = struct.unpack_from(">h", self.hmtx, self.num_hmetrics * 4 +
+                                 (g - self.num_hmetrics) * 2)[0]
+        return advance, lsb
+
+    def components(self, g):
+        """yields (flags, offset of glyph index, glyph index, dx, dy, matrix)
+        for each part of a composite glyph"""
+        data = self.glyph_data(g)
+        if len(data) < 10 or struct.unpack_from(">h", data, 0)[0] >= 0:
+            return
+        at = 10
+        while True:
+            flags, index = struct.unpack_from(">HH", data, at)
+            index_at = at + 2
+            at += 4
+            if flags & 0x0001:  # ARG_1_AND_2_ARE_WORDS
+                a, b = struct.unpack_from(">hh", data, at)
+                at += 4
+            else:
+                a, b = struct.unpack_from(">bb", data, at)
+                at += 2
+            m = (1.0, 0.0, 0.0, 1.0)
+            if flags & 0x0008:  # WE_HAVE_A_SCALE
+                s = struct.unpack_from(">h", data, at)[0] / 16384.0
+                m = (s, 0.0, 0.0, s)
+                at += 2
+            elif flags & 0x0040:  # WE_HAVE_AN_X_AND_Y_SCALE
+                sx, sy = struct.unpack_from(">hh", data, at)
+                m = (sx / 16384.0, 0.0, 0.0, sy / 16384.0)
+                at += 4
+            elif flags & 0x0080:  # WE_HAVE_A_TWO_BY_TWO
+                m = tuple(v / 16384.0 for v in
+                          struct.unpack_from(">hhhh", data, at))
+                at += 8
+            # point matching (args aren't offsets) is rare enough to treat
+            # as no offset
+            dx, dy = (a, b) if flags & 0x0002 else (0, 0)
+            yield flags, index_at, index, dx, dy, m
+            if not flags & 0x0020:  # MORE_COMPONENTS
+                break
+
+    def contours(self, g, depth=0):
+        """returns the glyph's contours as lists of (x, y, on_curve)"""
+        data = self.glyph_data(g)
+        if len(data) == 0:
+            return []
+        count = struct.unpack_from(">h", data, 0)[0]
+        if count < 0:
+            result = []
+            if depth > 8:
+                return result
+            for _, _, index, dx, dy, m in self.components(g):
+                for contour in self.contours(index, depth + 1):
+                    result.append([(m[0] * x + m[2] * y + dx,
+                                    m[1] * x + m[3] * y + dy, on)
+                                   for x, y, on in contour])
+            return result
+        ends = struct.unpack_from(">%dH" % count, data, 10)
+        at = 10 + count * 2
+        at += 2 + struct.unpack_from(">H", data, at)[0]
+        points = ends[-1] + 1 if count else 0
+        flags = []
+        while len(flags) < points:
+            f = data[at]
+            at += 1
+            flags.append(f)
+            if f & 0x08:
+                flags.extend([f] * data[at])
+                at += 1
+        coords = []
+        for short_bit, same_bit in ((0x02, 0x10), (0x04, 0x20)):
+            values = []
+            v = 0
+            for f in flags:
+                if f & short_bit:
+                    d = data[at]
+                    at += 1
+                    v += d if f & same_bit else -d
+                elif not f & same_bit:
+                    v += struct.unpack_from(">h", data, at)[0]
+                    at += 2
+                values.append(v)
+            coords.append(values)
+        result = []
+        start = 0
+        for end in ends:
+            result.append([(coords[0][i], coords[1][i], bool(flags[i] & 1))
+                           for i in range(start, end + 1)])
+            start = end + 1
+        return result
+
+
+def checksum(data):
+    data += b"\0" * (-len(data) % 4)
+    return sum(struct.unpack(">%dI" % (len(data) // 4), data)) & 0xFFFFFFFF
+
+
+def subset(font, chars):
+    # .notdef, the mapped glyphs, and anything they're built from
+    keep = [0]
+    pending = [font.cmap[ord(c)] for c in chars if ord(c) in font.cmap]
+    while pending:
+        g = pending.pop()
+        if g in keep:
+            continue
+        keep.append(g)
+        pending.extend(index for _, _, index, _, _, _ in font.components(g))
+    keep = [0] + sorted(g for g in keep if g != 0)
+    remap = {g: i for i, g in enumerate(keep)}
+
+    glyf = b""
+    loca = []
+    hmtx = b""
+    for g in keep:
+        data = bytearray(font.glyph_data(g))
+        for _, index_at, index, _, _, _ in font.components(g):
+            struct.pack_into(">H", data, index_at, remap[index])
+        data += b"\0" * (-len(data) % 4)
+        loca.append(len(glyf))
+        glyf += bytes(data)
+        hmtx += struct.pack(">Hh", *font.metrics(g))
+    loca.append(len(glyf))
+
+    mapped = sorted((ord(c), remap[font.cmap[ord(c)]]) for c in set(chars)
+                    if ord(c) in font.cmap)
+    # one segment per character keeps it simple, plus the required end
+    segments = [(c, c, (g - c) & 0xFFFF) for c, g in mapped]
+    segments.append((0xFFFF, 0xFFFF, 1))
+    seg_count = len(segments)
+    search = 2 ** int(math.log2(seg_count)) * 2
+    sub = struct.pack(">HHHHHHH", 4, 0, 0, seg_count * 2, search,
+                      int(math.log2(search // 2)), seg_count * 2 - search)
+    sub += b"".join(struct.pack(">H", s[1]) for s in segments)
+    sub += struct.pack(">H", 0)
+    sub += b"".join(struct.pack(">H", s[0]) for s in segments)
+    sub += b"".join(struct.pack(">H", s[2]) for s in segments)
+    sub += b"".join(struct.pack(">H", 0) for s in segments)
+    sub = sub[:2] + struct.pack(">H", len(sub)) + sub[4:]
+    cmap = struct.pack(">HHHHI", 0, 1, 3, 1, 12) + sub
+
+    head = bytearray(font.table("head"))
+    struct.pack_into(">I", head, 8, 0)  # checkSumAdjustment, set below
+    struct.pack_into(">h", head, 50, 1)  # long loca
+    hhea = bytearray(font.table("hhea"))
+    struct.pack_into(">H", hhea, 34, len(keep))
+    maxp = bytearray(font.table("maxp"))
+    struct.pack_into(">H", maxp, 4, len(keep))
+    post = bytearray(font.table("post")[:32])
+    struct.pack_into(">I", post, 0, 0x00030000)  # no glyph names
+
+    tables = {
+        "cmap": cmap,
+        "glyf": glyf,
+        "head": bytes(head),
+        "hhea": bytes(hhea),
+        "hmtx": hmtx,
+        "loca": struct.pack(">%dI" % len(loca), *loca),
+        "maxp": bytes(maxp),
+        "post": bytes(post),
+    }
+    # hinting and naming tables come along as is. layout tables reference
+    # glyph ids that no longer exist, so they're dropped
+    for tag in ("OS/2", "name", "cvt ", "fpgm", "prep", "gasp"):
+        if tag in font.tables:
+            tables[tag] = font.table(tag)
+
+    tags = sorted(tables)
+    search = 2 ** int(math.log2(len(tags)))
+    out = struct.pack(">IHHHH", 0x00010000, len(tags), search * 16,
+                      int(math.log2(search)), len(tags) * 16 - search * 16)
+    offset = 12 + len(tags) * 16
+    directory = b""
+    body = b""
+    for tag in tags:
+        data = tables[tag]
+        directory += struct.pack(">4sIII", tag.encode("latin-1"),
+                                 checksum(data), offset + len(body), len(data))
+        body += data + b"\0" * (-len(data) % 4)
+    out += directory + body
+    head_at = offset + sum(len(tables[t]) + (-len(tables[t]) % 4)
+                           for t in tags[:tags.index("head")])
+    out = bytearray(out)
+    struct.pack_into(">I", out, head_at + 8,
+                     (0xB1B0AFBA - checksum(bytes(out))) & 0xFFFFFFFF)
+    return bytes(out)
+
+
+def flatten(contour, scale):
+    """turns a contour into a closed polyline in pixels, y down"""
+    points = [(x * scale, -y * scale, on) for x, y, on in contour]
+    if not points:
+        return []
+    # start on an on curve point, making one up if there isn't one
+    start = next((i for i, p in enumerate(points) if p[2]), None)
+    if start is None:
+        a, b = points[0], points[1 % len(points)]
+        points.insert(0, ((a[0] + b[0]) / 2, (a[1] + b[1]) / 2, True))
+        start = 0
+    points = points[start:] + points[:start] + [points[start]]
+    result = [points[0][:2]]
+    control = None
+    for x, y, on in points[1:]:
+        if on:
+            if control is None:
+                result.append((x, y))
+            else:
+                result.extend(quadratic(result[-1], control, (x, y)))
+                control = None
+        else:
+            if control is not None:
+                mid = ((control[0] + x) / 2, (control[1] + y) / 2)
+                result.extend(quadratic(result[-1], control, mid))
+            control = (x, y)
+    if control is not None:
+        result.extend(quadratic(result[-1], control, result[0]))
+    return result
+
+
+def quadratic(p0, p1, p2):
+    length = math.hypot(p1[0] - p0[0], p1[1] - p0[1]) + \
+        math.hypot(p2[0] - p1[0], p2[1] - p1[1])
+    steps = max(2, int(length))
+    result = []
+    for i in range(1, steps + 1):
+        t = i / steps
+        u = 1 - t
+        result.append((u * u * p0[0] + 2 * u * t * p1[0] + t * t * p2[0],
+                       u * u * p0[1] + 2 * u * t * p1[1] + t * t * p2[1]))
+    return result
+
+
+def rasterize(polylines, samples=16):
+    """renders polylines with the nonzero rule. returns (left, top, width,
+    height, coverage bytes)"""
+    points = [p for line in polylines for p in line]
+    if not points:
+        return 0, 0, 0, 0, b""
+    left = int(math.floor(min(p[0] for p in points)))
+    top = int(math.floor(min(p[1] for p in points)))
+    width = int(math.ceil(max(p[0] for p in points))) - left
+    height = int(math.ceil(max(p[1] for p in points))) - top
+    edges = []
+    for line in polylines:
+        for (x0, y0), (x1, y1) in zip(line, line[1:]):
+            if y0 != y1:
+                edges.append((x0 - left, y0 - top, x1 - left, y1 - top))
+    coverage = [0.0] * (width * height)
+    for row in range(height):
+        for s in range(samples):
+            y = row + (s + 0.5) / samples
+            crossings = []
+            for x0, y0, x1, y1 in edges:
+                if (y0 <= y < y1) or (y1 <= y < y0):
+                    x = x0 + (y - y0) * (x1 - x0) / (y1 - y0)
+                    crossings.append((x, 1 if y1 > y0 else -1))
+            crossings.sort()
+            winding = 0
+            for i, (x, direction) in enumerate(crossings):
+                winding += direction
+                if winding != 0 and i + 1 < len(crossings):
+                    span(coverage, row * width, width, x, crossings[i + 1][0],
+                         1.0 / samples)
+    alpha = bytes(min(255, int(round(c * 255))) for c in coverage)
+    return left, top, width, height, alpha
+
+
+def span(coverage, row_at, width, xa, xb, weight):
+    """adds exact horizontal coverage of [xa, xb) to a row"""
+    xa = max(0.0, xa)
+    xb = min(float(width), xb)
+    if xb <= xa:
+        return
+    first = int(xa)
+    last = int(math.ceil(xb)) - 1
+    if first == last:
+        coverage[row_at + first] += (xb - xa) * weight
+        return
+    coverage[row_at + first] += (first + 1 - xa) * weight
+    for x in range(first + 1, last):
+        coverage[row_at + x] += weight
+    coverage[row_at + last] += (xb - last) * weight
+
+
+def vlw(font, chars, size):
+    scale = size / float(font.ascender - font.descender)
+    glyphs = []
+    for c in sorted(set(chars), key=ord):
+        g = font.cmap.get(ord(c))
+        if g is None:
+            continue
+        polylines = [flatten(contour, scale) for contour in font.contours(g)]
+        left, top, width, height, alpha = rasterize(polylines)
+        advance = int(round(font.metrics(g)[0] * scale))
+        # unicode, height, width, x advance, top above the baseline, left
+        glyphs.append((struct.pack(">7i", ord(c), height, width, advance,
+                                   -top, left, 0), alpha))
+    out = struct.pack(">6i", len(glyphs), 11, size, 0,
+                      int(round(font.ascender * scale)),
+                      int(round(-font.descender * scale)))
+    out += b"".join(g[0] for g in glyphs)
+    out += b"".join(g[1] for g in glyphs)
+    return out
+
+
+def write_header(path, name, data, description):
+    guard = name.upper() + "_H"
+    lines = [
+        "// generated by build_tools/fontgen.py - do not edit",
+        "// " + description,
+        "// Add #define %s_IMPLEMENTATION" % name.upper(),
+        "// to exactly one CPP file before including this file",
+        "#ifndef " + guard,
+        "#define " + guard,
+        "#include <stdint.h>",
+        "",
+        "extern const uint8_t %s[%d];" % (name, len(data)),
+        "#endif",
+        "#ifdef %s_IMPLEMENTATION" % name.upper(),
+        "",
+        "const uint8_t %s[%d] = {" % (name, len(data)),
+    ]
+    for i in range(0, len(data), 16):
+        lines.append("\t" + "".join("0x%02x," % b for b in data[i:i + 16]))
+    lines[-1] = lines[-1][:-1]
+    lines += ["};", "#endif", ""]
+    with open(path, "w", newline="\n") as f:
+        f.write("\n".join(lines))
+
+
+def main(argv):
+    if len(argv) < 6 or argv[1] not in ("subset", "vlw"):
+        print(__doc__)
+        return 1
+    command, source, output, name, chars = argv[1:6]
+    data = read_font_bytes(source)
+    font = TrueType(data)
+    shown = "".join(sorted(set(chars), key=ord))
+    if command == "subset":
+        result = subset(font, chars)
+        description = "TrueType subset of %s: \"%s\"" % (
+            os.path.basename(source), shown)
+    else:
+        size = int(argv[6])
+        result = vlw(font, chars, size)
+        description = "%dpx VLW font from %s: \"%s\"" % (
+            size, os.path.basename(source), shown)
+    write_header(output, name, result, description)
+    print("%s: %d bytes (source font %d bytes)" % (output, len(result),
+                                                   len(data)))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv))
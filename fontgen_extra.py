@@ -0,0 +1,13 @@
+Import("env")
+
+print("Font generation enabled")
+
+# the panel only ever draws these, so only these go into the firmware. keep
+# them in sync with the captions and label sizes in control-esp-idf.cpp
+caption_chars = "Reset allQR LinkMain screen"
+caption_size = 37 # LCD_WIDTH / 8 + 1 - 4
+digit_chars = "0123456789"
+digit_size = 40 # LCD_HEIGHT / 6
+
+env.Execute("\"$PYTHONEXE\" ./build_tools/fontgen.py vlw ./include/assets/OpenSans_Regular.h ./include/assets/OpenSans_caption.h OpenSans_caption \"%s\" %d" % (caption_chars, caption_size))
+env.Execute("\"$PYTHONEXE\" ./build_tools/fontgen.py vlw ./include/assets/OpenSans_Regular.h ./include/assets/OpenSans_digits.h OpenSans_digits \"%s\" %d" % (digit_chars, digit_size))
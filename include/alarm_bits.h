@@ -0,0 +1,185 @@
+#ifndef ALARM_BITS_H
+#define ALARM_BITS_H
+#include <stdint.h>
+#include <stddef.h>
+#include <atomic>
+
+// Alarm states packed 32 to a word and published under a sequence lock, so
+// any task can take a consistent snapshot without blocking the writer or
+// other readers. Writers are serialized by <Lock>, which is anything with
+// lock() and unlock(). Readers spin while a write is in progress, so writes
+// must stay short.
+
+// an inclusive run of alarms to switch on or off
+struct alarm_range {
+    uint16_t first;
+    uint16_t last;
+    bool on;
+};
+
+template <size_t Count, typename Lock>
+class alarm_bits {
+   public:
+    static constexpr const size_t words = (Count + 31) / 32;
+    struct snapshot {
+        // goes up by one every time any alarm changes
+        uint32_t version;
+        uint32_t values[words];
+        bool value(size_t alarm) const {
+            return (values[alarm / 32] >> (alarm % 32)) & 1;
+        }
+    };
+
+   private:
+    std::atomic<uint32_t> m_values[words];
+    std::atomic<uint32_t> m_version;
+    // odd while a write is in progress
+    std::atomic<uint32_t> m_seq;
+    Lock m_lock;
+    // the bits of <word> that are alarms. the tail of the last one isn't
+    static constexpr uint32_t word_mask(size_t word) {
+        return (word == words - 1 && (Count % 32) != 0)
+                   ? (UINT32_C(1) << (Count % 32)) - 1
+                   : UINT32_MAX;
+    }
+    void write_begin() {
+        m_lock.lock();
+        m_seq.store(m_seq.load(std::memory_order_relaxed) + 1,
+                    std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+    }
+    void write_end(bool changed) {
+        if (changed) {
+            m_version.store(m_version.load(std::memory_order_relaxed) + 1,
+                            std::memory_order_relaxed);
+        }
+        m_seq.store(m_seq.load(std::memory_order_relaxed) + 1,
+                    std::memory_order_release);
+        m_lock.unlock();
+    }
+    // replaces the <mask> bits of word <word> with those of <value>. returns
+    // the bits that changed. only between write_begin() and write_end()
+    uint32_t write_word(size_t word, uint32_t mask, uint32_t value) {
+        const uint32_t old_value =
+            m_values[word].load(std::memory_order_relaxed);
+        const uint32_t new_value = (old_value & ~mask) | (value & mask);
+        if (old_value != new_value) {
+            m_values[word].store(new_value, std::memory_order_relaxed);
+        }
+        return old_value ^ new_value;
+    }
+    // the bits of word <word> that <range> covers
+    static uint32_t range_mask(const alarm_range& range, size_t word) {
+        uint32_t mask = UINT32_MAX;
+        if (word == range.first / 32u) {
+            mask &= UINT32_MAX << (range.first % 32);
+        }
+        if (word == range.last / 32u) {
+            mask &= UINT32_MAX >> (31 - (range.last % 32));
+        }
+        return mask;
+    }
+    bool version_matches(const uint32_t* expected_version) const {
+        return expected_version == nullptr ||
+               *expected_version == m_version.load(std::memory_order_relaxed);
+    }
+
+   public:
+    alarm_bits() : m_version(0), m_seq(0) {
+        for (size_t i = 0; i < words; ++i) {
+            m_values[i].store(0, std::memory_order_relaxed);
+        }
+    }
+    void get_snapshot(snapshot* out_snapshot) const {
+        uint32_t seq;
+        do {
+            seq = m_seq.load(std::memory_order_acquire);
+            for (size_t i = 0; i < words; ++i) {
+                out_snapshot->values[i] =
+                    m_values[i].load(std::memory_order_relaxed);
+            }
+            out_snapshot->version = m_version.load(std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_acquire);
+        } while ((seq & 1) || seq != m_seq.load(std::memory_order_relaxed));
+    }
+    // switches one alarm. returns true if that changed it
+    bool set(size_t alarm, bool on) {
+        if (alarm >= Count) {
+            return false;
+        }
+        const uint32_t mask = UINT32_C(1) << (alarm % 32);
+        write_begin();
+        const bool changed = write_word(alarm / 32, mask, on ? mask : 0) != 0;
+        write_end(changed);
+        return changed;
+    }
+    // replaces every alarm with the packed <values>. with <expected_version>,
+    // does nothing and returns false unless that's still the current version.
+    // the bits that changed are or'd into <out_changed>
+    bool set_all(const uint32_t* values, const uint32_t* expected_version,
+                 uint32_t* out_changed) {
+        bool changed = false;
+        write_begin();
+        if (!version_matches(expected_version)) {
+            write_end(false);
+            return false;
+        }
+        for (size_t i = 0; i < words; ++i) {
+            const uint32_t bits = write_word(i, word_mask(i), values[i]);
+            out_changed[i] |= bits;
+            changed |= bits != 0;
+        }
+        write_end(changed);
+        return true;
+    }
+    // applies <ranges> in order, touching only the words they cover. ranges
+    // must lie within the alarms. takes <expected_version> and <out_changed>
+    // like set_all()
+    bool set_ranges(const alarm_range* ranges, size_t count,
+                    const uint32_t* expected_version, uint32_t* out_changed) {
+        bool changed = false;
+        write_begin();
+        if (!version_matches(expected_version)) {
+            write_end(false);
+            return false;
+        }
+        for (size_t i = 0; i < count; ++i) {
+            const alarm_range& r = ranges[i];
+            const size_t first_word = r.first / 32, last_word = r.last / 32;
+            for (size_t w = first_word; w <= last_word; ++w) {
+                const uint32_t mask = range_mask(r, w);
+                const uint32_t bits = write_word(w, mask, r.on ? mask : 0);
+                out_changed[w] |= bits;
+                changed |= bits != 0;
+            }
+        }
+        write_end(changed);
+        return true;
+    }
+    // replaces every alarm with the packed <values>, if there are any, then
+    // applies <ranges> on top, as one change under one version check. an
+    // alarm that ends up where it started doesn't count as changed. takes
+    // <expected_version> and <out_changed> like set_all()
+    bool apply(const uint32_t* values, const alarm_range* ranges,
+               size_t count, const uint32_t* expected_version,
+               uint32_t* out_changed) {
+        if (values == nullptr) {
+            return set_ranges(ranges, count, expected_version, out_changed);
+        }
+        // work out the result first so the write stays short
+        uint32_t next[words];
+        for (size_t i = 0; i < words; ++i) {
+            next[i] = values[i];
+        }
+        for (size_t i = 0; i < count; ++i) {
+            const alarm_range& r = ranges[i];
+            for (size_t w = r.first / 32; w <= r.last / 32u; ++w) {
+                const uint32_t mask = range_mask(r, w);
+                next[w] = (next[w] & ~mask) | (r.on ? mask : 0);
+            }
+        }
+        return set_all(next, expected_version, out_changed);
+    }
+};
+
+#endif
@@ -0,0 +1,252 @@
+#ifndef ALARM_PROTOCOL_H
+#define ALARM_PROTOCOL_H
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include "config.h"
+#include "serial_frame.h"
+
+// Builds and reads the payloads of the alarm commands in config.h, for
+// both sides of the link. <wide> picks the 16-bit forms, which a peer only
+// gets once it has said it speaks version 2. The 8-bit forms can only
+// address the first 256 alarms.
+
+// the largest payload an alarm command takes
+static constexpr const size_t alarm_protocol_max_payload =
+    5 + (set_alarms_max_count + 7) / 8;
+static_assert(alarm_protocol_max_payload <= serial_frame_max_payload,
+              "SET_ALARMS16 must fit in a frame");
+
+static inline size_t alarm_protocol_write_id(uint8_t* out_payload,
+                                             uint8_t id8, uint8_t id16,
+                                             size_t alarm, bool wide) {
+    if (wide) {
+        out_payload[0] = id16;
+        out_payload[1] = alarm & 0xFF;
+        out_payload[2] = (alarm >> 8) & 0xFF;
+        return 3;
+    }
+    if (alarm > 255) {
+        return 0;
+    }
+    out_payload[0] = id8;
+    out_payload[1] = (uint8_t)alarm;
+    return 2;
+}
+// writes a SET_ALARM or CLEAR_ALARM for <alarm>. returns the payload size,
+// or 0 if the peer can't address it
+static inline size_t alarm_protocol_write_alarm(size_t alarm, bool on,
+                                                bool wide,
+                                                uint8_t* out_payload) {
+    return on ? alarm_protocol_write_id(out_payload, SET_ALARM, SET_ALARM16,
+                                        alarm, wide)
+              : alarm_protocol_write_id(out_payload, CLEAR_ALARM,
+                                        CLEAR_ALARM16, alarm, wide);
+}
+// writes an ALARM_THROWN for <alarm>. returns the payload size, or 0 if the
+// peer can't address it
+static inline size_t alarm_protocol_write_thrown(size_t alarm, bool wide,
+                                                 uint8_t* out_payload) {
+    return alarm_protocol_write_id(out_payload, ALARM_THROWN, ALARM_THROWN16,
+                                   alarm, wide);
+}
+// writes a SET_ALARMS carrying as many of the <count> alarms from <first>
+// as fit, taking their states from the packed <values>. returns the payload
+// size, or 0 if the peer can't address <first>, and sets <out_count> to the
+// number of alarms it carries
+static inline size_t alarm_protocol_write_alarms(const uint32_t* values,
+                                                 size_t first, size_t count,
+                                                 bool wide,
+                                                 uint8_t* out_payload,
+                                                 size_t* out_count) {
+    if (!wide) {
+        if (first > 255) {
+            *out_count = 0;
+            return 0;
+        }
+        if (first + count > 256) {
+            count = 256 - first;
+        }
+    }
+    if (count > set_alarms_max_count) {
+        count = set_alarms_max_count;
+    }
+    size_t header_size;
+    if (wide) {
+        out_payload[0] = SET_ALARMS16;
+        out_payload[1] = first & 0xFF;
+        out_payload[2] = (first >> 8) & 0xFF;
+        out_payload[3] = count & 0xFF;
+        out_payload[4] = (count >> 8) & 0xFF;
+        header_size = 5;
+    } else {
+        out_payload[0] = SET_ALARMS;
+        out_payload[1] = (uint8_t)first;
+        out_payload[2] = (uint8_t)count;
+        header_size = 3;
+    }
+    uint8_t* mask = out_payload + header_size;
+    const size_t mask_size = (count + 7) / 8;
+    memset(mask, 0, mask_size);
+    for (size_t j = 0; j < count; ++j) {
+        const size_t alarm = first + j;
+        if ((values[alarm / 32] >> (alarm % 32)) & 1) {
+            mask[j / 8] |= (uint8_t)(1 << (j % 8));
+        }
+    }
+    *out_count = count;
+    return header_size + mask_size;
+}
+// writes a HELLO announcing protocol_version. <request> asks the peer to
+// answer with its own. returns the payload size
+static inline size_t alarm_protocol_write_hello(bool request,
+                                                uint8_t* out_payload) {
+    out_payload[0] = HELLO;
+    out_payload[1] = protocol_version;
+    out_payload[2] = request;
+    return 3;
+}
+// reads a HELLO. <out_version> is the version both sides speak, the lower of
+// the peer's and ours, and <out_request> is set if the peer wants a HELLO
+// back. returns false for other commands, or if the payload is short
+static inline bool alarm_protocol_read_hello(const uint8_t* payload,
+                                             size_t size,
+                                             uint8_t* out_version,
+                                             bool* out_request) {
+    if (size < 3 || payload[0] != HELLO) {
+        return false;
+    }
+    *out_version =
+        payload[1] < protocol_version ? payload[1] : protocol_version;
+    *out_request = payload[2] != 0;
+    return true;
+}
+
+// the bytes a frame with a payload of <size> takes on the wire: the CRC, the
+// COBS code byte and the delimiter on top of the payload
+static constexpr inline size_t alarm_protocol_frame_size(size_t size) {
+    return size + 3;
+}
+// a stretch of changed alarms to send together, either one frame per
+// changed alarm or as SET_ALARMS frames covering every alarm in it
+struct alarm_protocol_run {
+    size_t first;
+    size_t last;
+    // how many of them changed
+    size_t changed;
+    bool mask;
+    // the frames it takes
+    size_t frames;
+};
+// finds the next run of the set bits in <changed> at or after alarm
+// <start>, out of <count>. runs break at gaps long enough that another frame
+// costs less than carrying the gap in a mask. returns false if there are
+// none left the peer can address
+static inline bool alarm_protocol_next_run(const uint32_t* changed,
+                                           size_t count, size_t start,
+                                           bool wide,
+                                           alarm_protocol_run* out_run) {
+    if (!wide && count > 256) {
+        count = 256;
+    }
+    const size_t header_size = wide ? 5 : 3;
+    const size_t max_gap = 8 * alarm_protocol_frame_size(header_size);
+    size_t i = start;
+    while (i < count && !((changed[i / 32] >> (i % 32)) & 1)) {
+        // skip clear words whole
+        i = (i % 32 == 0 && changed[i / 32] == 0) ? i + 32 : i + 1;
+    }
+    if (i >= count) {
+        return false;
+    }
+    out_run->first = i;
+    out_run->last = i;
+    out_run->changed = 1;
+    for (++i; i < count && i - out_run->last <= max_gap; ++i) {
+        if ((changed[i / 32] >> (i % 32)) & 1) {
+            out_run->last = i;
+            ++out_run->changed;
+        }
+    }
+    // price it both ways. masks only come in frames of set_alarms_max_count
+    size_t mask_frames = 0;
+    size_t mask_cost = 0;
+    for (size_t left = out_run->last - out_run->first + 1; left > 0;) {
+        const size_t n =
+            left < set_alarms_max_count ? left : set_alarms_max_count;
+        ++mask_frames;
+        mask_cost += alarm_protocol_frame_size(header_size + (n + 7) / 8);
+        left -= n;
+    }
+    const size_t single_cost =
+        out_run->changed * alarm_protocol_frame_size(wide ? 3 : 2);
+    out_run->mask = mask_cost < single_cost;
+    out_run->frames = out_run->mask ? mask_frames : out_run->changed;
+    return true;
+}
+
+// a decoded alarm command: <count> alarms from <first>, switched to the
+// states in <values>, LSB first. the single alarm commands come back as a
+// count of one, with <values> pointing at <value>
+struct alarm_protocol_command {
+    // the COMMAND_ID
+    uint8_t id;
+    size_t first;
+    size_t count;
+    const uint8_t* values;
+    uint8_t value;
+};
+// decodes any of the SET, CLEAR, THROWN or SET_ALARMS commands in either
+// width. returns false for other commands, or if the payload is short
+static inline bool alarm_protocol_read(const uint8_t* payload, size_t size,
+                                       alarm_protocol_command* out_command) {
+    if (size == 0) {
+        return false;
+    }
+    out_command->id = payload[0];
+    out_command->count = 1;
+    out_command->values = &out_command->value;
+    switch (payload[0]) {
+        case SET_ALARM:
+        case CLEAR_ALARM:
+        case ALARM_THROWN:
+            if (size < 2) {
+                return false;
+            }
+            out_command->first = payload[1];
+            out_command->value = payload[0] != CLEAR_ALARM;
+            return true;
+        case SET_ALARM16:
+        case CLEAR_ALARM16:
+        case ALARM_THROWN16:
+            if (size < 3) {
+                return false;
+            }
+            out_command->first = payload[1] | ((size_t)payload[2] << 8);
+            out_command->value = payload[0] != CLEAR_ALARM16;
+            return true;
+        case SET_ALARMS:
+            if (size < 3 || size < 3 + ((size_t)payload[2] + 7) / 8) {
+                return false;
+            }
+            out_command->first = payload[1];
+            out_command->count = payload[2];
+            out_command->values = payload + 3;
+            return true;
+        case SET_ALARMS16:
+            if (size < 5) {
+                return false;
+            }
+            out_command->first = payload[1] | ((size_t)payload[2] << 8);
+            out_command->count = payload[3] | ((size_t)payload[4] << 8);
+            if (size < 5 + (out_command->count + 7) / 8) {
+                return false;
+            }
+            out_command->values = payload + 5;
+            return true;
+        default:
+            return false;
+    }
+}
+
+#endif
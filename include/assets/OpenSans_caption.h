@@ -0,0 +1,236 @@
+// generated by build_tools/fontgen.py - do not edit
+// 37px VLW font from OpenSans_Regular.h: " LMQRaceiklnrst"
+// Add #define OPENSANS_CAPTION_IMPLEMENTATION
+// to exactly one CPP file before including this file
+#ifndef OPENSANS_CAPTION_H
+#define OPENSANS_CAPTION_H
+#include <stdint.h>
+
+extern const uint8_t OpenSans_caption[3522];
+#endif
+#ifdef OPENSANS_CAPTION_IMPLEMENTATION
+
+const uint8_t OpenSans_caption[3522] = {
+	0x00,0x00,0x00,0x0f,0x00,0x00,0x00,0x0b,0x00,0x00,0x00,0x25,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x1d,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x20,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4c,0x00,0x00,0x00,0x14,0x00,0x00,0x00,0x0c,
+	0x00,0x00,0x00,0x0e,0x00,0x00,0x00,0x14,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x4d,0x00,0x00,0x00,0x14,0x00,0x00,0x00,0x14,0x00,0x00,0x00,0x19,
+	0x00,0x00,0x00,0x14,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x51,
+	0x00,0x00,0x00,0x19,0x00,0x00,0x00,0x13,0x00,0x00,0x00,0x15,0x00,0x00,0x00,0x14,
+	0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x52,0x00,0x00,0x00,0x14,
+	0x00,0x00,0x00,0x0f,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x14,0x00,0x00,0x00,0x02,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x61,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x0c,
+	0x00,0x00,0x00,0x0f,0x00,0x00,0x00,0x0f,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x63,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x0c,0x00,0x00,0x00,0x0d,
+	0x00,0x00,0x00,0x0f,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x65,
+	0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x0d,0x00,0x00,0x00,0x0f,0x00,0x00,0x00,0x0f,
+	0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0x00,0x00,0x00,0x14,
+	0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x14,0x00,0x00,0x00,0x02,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6b,0x00,0x00,0x00,0x15,0x00,0x00,0x00,0x0c,
+	0x00,0x00,0x00,0x0e,0x00,0x00,0x00,0x15,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x6c,0x00,0x00,0x00,0x15,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x07,
+	0x00,0x00,0x00,0x15,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6e,
+	0x00,0x00,0x00,0x0f,0x00,0x00,0x00,0x0d,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x0f,
+	0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x72,0x00,0x00,0x00,0x0f,
+	0x00,0x00,0x00,0x09,0x00,0x00,0x00,0x0b,0x00,0x00,0x00,0x0f,0x00,0x00,0x00,0x02,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x73,0x00,0x00,0x00,0x10,0x00,0x00,0x00,0x0b,
+	0x00,0x00,0x00,0x0d,0x00,0x00,0x00,0x0f,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x74,0x00,0x00,0x00,0x13,0x00,0x00,0x00,0x0a,0x00,0x00,0x00,0x0a,
+	0x00,0x00,0x00,0x12,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x60,0x58,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x55,0xff,0xeb,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x55,0xff,0xeb,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x55,0xff,0xeb,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x55,0xff,0xeb,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x55,0xff,0xeb,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x55,0xff,0xeb,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x55,0xff,0xeb,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x55,0xff,0xeb,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x55,0xff,0xeb,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x55,0xff,0xeb,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x55,0xff,0xeb,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x55,0xff,0xeb,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x55,0xff,0xeb,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x55,0xff,0xeb,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x55,0xff,0xeb,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x55,0xff,0xeb,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x55,0xff,0xec,0x10,0x10,0x10,0x10,0x10,
+	0x10,0x10,0x10,0x08,0x55,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x7a,
+	0x55,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x7a,0x20,0x60,0x60,0x60,
+	0x0e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x37,0x60,0x60,0x54,
+	0x55,0xff,0xff,0xff,0x68,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0xd6,0xff,0xff,0xdf,0x55,0xff,0xf8,0xff,0xca,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x3a,0xff,0xf9,0xff,0xdf,0x55,0xff,0xb3,0xfa,0xff,0x2d,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9d,0xff,0xad,0xff,0xdf,0x55,0xff,0xac,0xae,
+	0xff,0x8e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0d,0xf3,0xf9,0x60,0xff,0xdf,
+	0x55,0xff,0xb6,0x4c,0xff,0xea,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x63,0xff,
+	0xab,0x56,0xff,0xdf,0x55,0xff,0xbc,0x04,0xe6,0xff,0x53,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0xc6,0xff,0x48,0x5e,0xff,0xdf,0x55,0xff,0xbf,0x00,0x88,0xff,0xb5,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x2a,0xff,0xe2,0x03,0x60,0xff,0xdf,0x55,0xff,0xbf,0x00,
+	0x27,0xfe,0xfc,0x1b,0x00,0x00,0x00,0x00,0x00,0x8c,0xff,0x82,0x00,0x61,0xff,0xdf,
+	0x55,0xff,0xbf,0x00,0x00,0xc4,0xff,0x7a,0x00,0x00,0x00,0x00,0x06,0xea,0xfd,0x21,
+	0x00,0x61,0xff,0xdf,0x55,0xff,0xbf,0x00,0x00,0x62,0xff,0xdb,0x01,0x00,0x00,0x00,
+	0x53,0xff,0xbc,0x00,0x00,0x61,0xff,0xdf,0x55,0xff,0xbf,0x00,0x00,0x0d,0xf3,0xff,
+	0x3f,0x00,0x00,0x00,0xb6,0xff,0x5a,0x00,0x00,0x61,0xff,0xdf,0x55,0xff,0xbf,0x00,
+	0x00,0x00,0x9e,0xff,0xa1,0x00,0x00,0x1c,0xfc,0xee,0x08,0x00,0x00,0x61,0xff,0xdf,
+	0x55,0xff,0xbf,0x00,0x00,0x00,0x3d,0xff,0xf4,0x0e,0x00,0x7c,0xff,0x94,0x00,0x00,
+	0x00,0x61,0xff,0xdf,0x55,0xff,0xbf,0x00,0x00,0x00,0x01,0xd9,0xff,0x65,0x02,0xdd,
+	0xff,0x31,0x00,0x00,0x00,0x61,0xff,0xdf,0x55,0xff,0xbf,0x00,0x00,0x00,0x00,0x78,
+	0xff,0xc7,0x43,0xff,0xce,0x00,0x00,0x00,0x00,0x61,0xff,0xdf,0x55,0xff,0xbf,0x00,
+	0x00,0x00,0x00,0x1a,0xfc,0xff,0xcb,0xff,0x6b,0x00,0x00,0x00,0x00,0x61,0xff,0xdf,
+	0x55,0xff,0xbf,0x00,0x00,0x00,0x00,0x00,0xb4,0xff,0xff,0xf7,0x11,0x00,0x00,0x00,
+	0x00,0x61,0xff,0xdf,0x55,0xff,0xbf,0x00,0x00,0x00,0x00,0x00,0x53,0xff,0xff,0xa5,
+	0x00,0x00,0x00,0x00,0x00,0x61,0xff,0xdf,0x55,0xff,0xbf,0x00,0x00,0x00,0x00,0x00,
+	0x06,0xea,0xff,0x42,0x00,0x00,0x00,0x00,0x00,0x61,0xff,0xdf,0x00,0x00,0x00,0x00,
+	0x00,0x03,0x44,0x81,0xa4,0xaf,0xa9,0x89,0x50,0x08,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x5a,0xe1,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xec,0x6d,0x01,0x00,
+	0x00,0x00,0x00,0x00,0x01,0x94,0xff,0xff,0xee,0x9a,0x67,0x53,0x61,0x8a,0xdd,0xff,
+	0xff,0xaa,0x05,0x00,0x00,0x00,0x00,0x77,0xff,0xff,0x9f,0x0d,0x00,0x00,0x00,0x00,
+	0x00,0x02,0x72,0xfc,0xff,0x93,0x00,0x00,0x00,0x20,0xf8,0xff,0xa2,0x01,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x6e,0xff,0xfe,0x38,0x00,0x00,0x8d,0xff,0xef,0x10,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xce,0xff,0xae,0x00,0x00,0xe0,
+	0xff,0x96,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x69,0xff,0xf9,
+	0x0b,0x1a,0xff,0xff,0x52,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x27,0xff,0xff,0x40,0x3e,0xff,0xff,0x28,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x03,0xfa,0xff,0x66,0x51,0xff,0xff,0x13,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe9,0xff,0x79,0x55,0xff,0xff,0x0f,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe5,0xff,0x7d,0x4a,0xff,0xff,
+	0x1a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf0,0xff,0x73,
+	0x30,0xff,0xff,0x37,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0d,
+	0xff,0xff,0x57,0x08,0xf9,0xff,0x6a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x3f,0xff,0xff,0x29,0x00,0xbd,0xff,0xbc,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x8f,0xff,0xe1,0x01,0x00,0x5d,0xff,0xfe,0x3a,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x17,0xf1,0xff,0x7f,0x00,0x00,0x04,0xd2,0xff,
+	0xde,0x1c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x09,0xbe,0xff,0xe6,0x0f,0x00,0x00,
+	0x00,0x2c,0xf0,0xff,0xe8,0x60,0x07,0x00,0x00,0x00,0x02,0x47,0xd1,0xff,0xf9,0x42,
+	0x00,0x00,0x00,0x00,0x00,0x33,0xdf,0xff,0xff,0xf6,0xcb,0xbc,0xc5,0xef,0xff,0xff,
+	0xec,0x47,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0b,0x76,0xd5,0xff,0xff,0xff,0xff,
+	0xff,0xf6,0x85,0x13,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x13,
+	0x36,0x40,0x80,0xff,0xff,0x6e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x94,0xff,0xfe,0x65,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xb4,0xff,0xfd,0x5c,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0c,0xce,0xff,
+	0xfb,0x54,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x1a,0x9d,0x9f,0x9a,0x15,0x00,0x20,0x60,0x60,0x60,0x60,0x60,0x60,0x50,0x2b,
+	0x02,0x00,0x00,0x00,0x00,0x00,0x55,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xe8,
+	0x7e,0x08,0x00,0x00,0x00,0x55,0xff,0xf6,0x8f,0x8f,0x8f,0x9e,0xb8,0xee,0xff,0xff,
+	0xbc,0x05,0x00,0x00,0x55,0xff,0xeb,0x00,0x00,0x00,0x00,0x00,0x07,0x81,0xff,0xff,
+	0x6b,0x00,0x00,0x55,0xff,0xeb,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xb8,0xff,0xc4,
+	0x00,0x00,0x55,0xff,0xeb,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x72,0xff,0xea,0x00,
+	0x00,0x55,0xff,0xeb,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x68,0xff,0xee,0x00,0x00,
+	0x55,0xff,0xeb,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x91,0xff,0xca,0x00,0x00,0x55,
+	0xff,0xeb,0x00,0x00,0x00,0x00,0x00,0x00,0x1e,0xed,0xff,0x72,0x00,0x00,0x55,0xff,
+	0xeb,0x00,0x00,0x00,0x0a,0x23,0x69,0xe4,0xff,0xc5,0x06,0x00,0x00,0x55,0xff,0xff,
+	0xff,0xff,0xff,0xff,0xff,0xff,0xfb,0x99,0x0b,0x00,0x00,0x00,0x55,0xff,0xfe,0xef,
+	0xef,0xef,0xef,0xff,0xff,0x50,0x00,0x00,0x00,0x00,0x00,0x55,0xff,0xeb,0x00,0x00,
+	0x00,0x00,0xb3,0xff,0xca,0x02,0x00,0x00,0x00,0x00,0x55,0xff,0xeb,0x00,0x00,0x00,
+	0x00,0x25,0xf9,0xff,0x67,0x00,0x00,0x00,0x00,0x55,0xff,0xeb,0x00,0x00,0x00,0x00,
+	0x00,0x89,0xff,0xed,0x14,0x00,0x00,0x00,0x55,0xff,0xeb,0x00,0x00,0x00,0x00,0x00,
+	0x0d,0xe6,0xff,0x9c,0x00,0x00,0x00,0x55,0xff,0xeb,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x5f,0xff,0xfd,0x39,0x00,0x00,0x55,0xff,0xeb,0x00,0x00,0x00,0x00,0x00,0x00,0x01,
+	0xc8,0xff,0xce,0x03,0x00,0x55,0xff,0xeb,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x37,
+	0xfe,0xff,0x6c,0x00,0x55,0xff,0xeb,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa0,
+	0xff,0xef,0x17,0x00,0x00,0x01,0x36,0x7e,0xac,0xbf,0xbc,0x9a,0x4f,0x01,0x00,0x00,
+	0x06,0xce,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xb2,0x04,0x00,0x00,0xb4,0xbe,0x65,
+	0x2a,0x10,0x29,0x85,0xfd,0xff,0x6a,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,
+	0xa2,0xff,0xbc,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x59,0xff,0xde,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0xff,0xe8,0x00,0x00,0x00,0x12,0x52,
+	0x7d,0x96,0xa1,0xaf,0xc3,0xff,0xe8,0x00,0x17,0xa3,0xfb,0xff,0xff,0xff,0xf2,0xe5,
+	0xe8,0xff,0xe8,0x10,0xdb,0xff,0xe2,0x6d,0x29,0x07,0x00,0x00,0x4b,0xff,0xe8,0x7c,
+	0xff,0xec,0x20,0x00,0x00,0x00,0x00,0x00,0x54,0xff,0xe8,0xb6,0xff,0xaa,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x7a,0xff,0xe8,0xb2,0xff,0xa3,0x00,0x00,0x00,0x00,0x00,0x08,
+	0xd9,0xff,0xe8,0x82,0xff,0xee,0x22,0x00,0x00,0x00,0x11,0xb0,0xfd,0xff,0xe8,0x1b,
+	0xeb,0xff,0xf4,0xaa,0x94,0xb1,0xf4,0xf4,0x49,0xfc,0xe8,0x00,0x2e,0xc6,0xff,0xff,
+	0xff,0xfe,0xc4,0x30,0x00,0xd3,0xe8,0x00,0x00,0x00,0x1c,0x3a,0x37,0x17,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x51,0x9b,0xc0,0xcb,0xb6,0x8a,0x41,0x00,0x00,
+	0x00,0x20,0xcd,0xff,0xff,0xff,0xff,0xff,0xff,0xd5,0x00,0x00,0x12,0xdf,0xff,0xe7,
+	0x72,0x36,0x2a,0x4a,0x89,0x64,0x00,0x00,0x93,0xff,0xe5,0x1b,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x09,0xf3,0xff,0x62,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,
+	0xff,0xfd,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x66,0xff,0xe2,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x75,0xff,0xd2,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x72,0xff,0xd8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5a,
+	0xff,0xf2,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0xff,0xff,0x33,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xd5,0xff,0xa5,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x54,0xff,0xff,0x87,0x08,0x00,0x00,0x00,0x09,0x3f,0x00,0x00,
+	0x00,0x89,0xff,0xff,0xec,0xba,0xb0,0xcb,0xf8,0xd1,0x00,0x00,0x00,0x00,0x54,0xd0,
+	0xff,0xff,0xff,0xff,0xf5,0x8c,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x39,0x3e,0x2a,
+	0x04,0x00,0x00,0x00,0x00,0x00,0x05,0x59,0xa7,0xc6,0xc3,0x9b,0x44,0x00,0x00,0x00,
+	0x00,0x00,0x1e,0xce,0xff,0xff,0xff,0xff,0xff,0xff,0xa8,0x07,0x00,0x00,0x0d,0xd9,
+	0xff,0xce,0x4a,0x16,0x1c,0x66,0xf0,0xff,0x9a,0x00,0x00,0x8a,0xff,0xd4,0x0a,0x00,
+	0x00,0x00,0x00,0x42,0xfe,0xfe,0x2e,0x07,0xef,0xff,0x4f,0x00,0x00,0x00,0x00,0x00,
+	0x00,0xcd,0xff,0x88,0x3c,0xff,0xfa,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x9a,0xff,
+	0xba,0x64,0xff,0xf6,0xaf,0xaf,0xaf,0xaf,0xaf,0xaf,0xaf,0xdb,0xff,0xce,0x75,0xff,
+	0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xd2,0x71,0xff,0xdd,0x20,0x20,
+	0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x1a,0x57,0xff,0xf2,0x03,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x22,0xff,0xff,0x3b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0xc7,0xff,0xba,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x3d,0xfc,0xff,0xa5,0x14,0x00,0x00,0x00,0x00,0x13,0x61,0x1f,0x00,0x00,0x62,0xfb,
+	0xff,0xf8,0xc4,0xaf,0xb4,0xd7,0xfd,0xff,0x33,0x00,0x00,0x00,0x34,0xb5,0xfc,0xff,
+	0xff,0xff,0xff,0xe7,0x96,0x12,0x00,0x00,0x00,0x00,0x00,0x0b,0x32,0x40,0x3a,0x1e,
+	0x01,0x00,0x00,0x74,0xe4,0x5b,0xd0,0xff,0xb6,0x7c,0xf2,0x63,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x5f,0x8f,0x4d,0xaa,0xff,0x89,0xaa,0xff,0x89,0xaa,0xff,0x89,0xaa,0xff,
+	0x89,0xaa,0xff,0x89,0xaa,0xff,0x89,0xaa,0xff,0x89,0xaa,0xff,0x89,0xaa,0xff,0x89,
+	0xaa,0xff,0x89,0xaa,0xff,0x89,0xaa,0xff,0x89,0xaa,0xff,0x89,0xaa,0xff,0x89,0x6a,
+	0x9f,0x51,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xaa,0xff,0x82,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xaa,0xff,0x82,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0xaa,0xff,0x82,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xaa,
+	0xff,0x82,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xaa,0xff,0x82,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xaa,0xff,0x82,0x00,0x00,0x00,0x00,0x00,0x2b,
+	0x8f,0x8f,0x2d,0xaa,0xff,0x82,0x00,0x00,0x00,0x00,0x23,0xe6,0xff,0x91,0x00,0xaa,
+	0xff,0x82,0x00,0x00,0x00,0x1c,0xde,0xff,0x9d,0x01,0x00,0xaa,0xff,0x82,0x00,0x00,
+	0x15,0xd7,0xff,0xa8,0x03,0x00,0x00,0xaa,0xff,0x82,0x00,0x10,0xce,0xff,0xb2,0x05,
+	0x00,0x00,0x00,0xaa,0xff,0x80,0x08,0xc4,0xff,0xbc,0x08,0x00,0x00,0x00,0x00,0xaa,
+	0xff,0x78,0xa7,0xff,0xde,0x0b,0x00,0x00,0x00,0x00,0x00,0xaa,0xff,0xd4,0xff,0xff,
+	0xfe,0x4f,0x00,0x00,0x00,0x00,0x00,0xaa,0xff,0xff,0xb1,0x94,0xff,0xee,0x20,0x00,
+	0x00,0x00,0x00,0xaa,0xff,0xae,0x03,0x05,0xc8,0xff,0xca,0x06,0x00,0x00,0x00,0xaa,
+	0xff,0x82,0x00,0x00,0x20,0xee,0xff,0x92,0x00,0x00,0x00,0xaa,0xff,0x82,0x00,0x00,
+	0x00,0x50,0xfe,0xff,0x54,0x00,0x00,0xaa,0xff,0x82,0x00,0x00,0x00,0x00,0x90,0xff,
+	0xf0,0x24,0x00,0xaa,0xff,0x82,0x00,0x00,0x00,0x00,0x06,0xca,0xff,0xce,0x08,0xaa,
+	0xff,0x82,0x00,0x00,0x00,0x00,0x00,0x22,0xef,0xff,0x97,0x6a,0x9f,0x56,0xaa,0xff,
+	0x89,0xaa,0xff,0x89,0xaa,0xff,0x89,0xaa,0xff,0x89,0xaa,0xff,0x89,0xaa,0xff,0x89,
+	0xaa,0xff,0x89,0xaa,0xff,0x89,0xaa,0xff,0x89,0xaa,0xff,0x89,0xaa,0xff,0x89,0xaa,
+	0xff,0x89,0xaa,0xff,0x89,0xaa,0xff,0x89,0xaa,0xff,0x89,0xaa,0xff,0x89,0xaa,0xff,
+	0x89,0xaa,0xff,0x89,0xaa,0xff,0x89,0xaa,0xff,0x89,0x5f,0x8f,0x19,0x00,0x31,0x8f,
+	0xba,0xc9,0xb3,0x76,0x15,0x00,0x00,0xaa,0xff,0x50,0x86,0xfd,0xff,0xff,0xff,0xff,
+	0xff,0xeb,0x36,0x00,0xaa,0xff,0xd9,0xff,0xa2,0x40,0x1b,0x25,0x5f,0xe5,0xff,0xdc,
+	0x03,0xaa,0xff,0xff,0x7e,0x00,0x00,0x00,0x00,0x00,0x38,0xfe,0xff,0x3e,0xaa,0xff,
+	0xee,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0xdb,0xff,0x6b,0xaa,0xff,0xb3,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0xbc,0xff,0x7a,0xaa,0xff,0x94,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0xb6,0xff,0x7c,0xaa,0xff,0x8a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xb6,
+	0xff,0x7c,0xaa,0xff,0x89,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xb6,0xff,0x7c,0xaa,
+	0xff,0x89,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xb6,0xff,0x7c,0xaa,0xff,0x89,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0xb6,0xff,0x7c,0xaa,0xff,0x89,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0xb6,0xff,0x7c,0xaa,0xff,0x89,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0xb6,0xff,0x7c,0xaa,0xff,0x89,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xb6,0xff,0x7c,
+	0xaa,0xff,0x89,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xb6,0xff,0x7c,0x5f,0x8f,0x19,
+	0x00,0x17,0x84,0xbc,0xc8,0x76,0xaa,0xff,0x40,0x3c,0xed,0xff,0xff,0xff,0x88,0xaa,
+	0xff,0x75,0xef,0xe8,0x76,0x3e,0x42,0x28,0xaa,0xff,0xf9,0xda,0x1c,0x00,0x00,0x00,
+	0x00,0xaa,0xff,0xff,0x36,0x00,0x00,0x00,0x00,0x00,0xaa,0xff,0xca,0x00,0x00,0x00,
+	0x00,0x00,0x00,0xaa,0xff,0x97,0x00,0x00,0x00,0x00,0x00,0x00,0xaa,0xff,0x89,0x00,
+	0x00,0x00,0x00,0x00,0x00,0xaa,0xff,0x89,0x00,0x00,0x00,0x00,0x00,0x00,0xaa,0xff,
+	0x89,0x00,0x00,0x00,0x00,0x00,0x00,0xaa,0xff,0x89,0x00,0x00,0x00,0x00,0x00,0x00,
+	0xaa,0xff,0x89,0x00,0x00,0x00,0x00,0x00,0x00,0xaa,0xff,0x89,0x00,0x00,0x00,0x00,
+	0x00,0x00,0xaa,0xff,0x89,0x00,0x00,0x00,0x00,0x00,0x00,0xaa,0xff,0x89,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x26,0x82,0xb5,0xc9,0xc4,0xaa,0x78,0x2e,0x00,0x00,
+	0x6f,0xfb,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x39,0x37,0xff,0xfb,0x7b,0x27,0x11,
+	0x18,0x44,0x89,0xb5,0x00,0x84,0xff,0x9b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x8a,0xff,0xa6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0xff,0xfe,0x86,0x0e,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x82,0xfe,0xff,0xf0,0x94,0x30,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x3f,0xbc,0xfe,0xff,0xff,0xc7,0x4a,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x27,0x8d,0xee,0xff,0xff,0x9b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0e,0x8a,0xff,
+	0xff,0x55,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa1,0xff,0x9f,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x7c,0xff,0xa6,0x51,0x3f,0x02,0x00,0x00,0x00,0x00,0x1b,
+	0xdb,0xff,0x6d,0x8d,0xff,0xe9,0xb3,0x96,0x98,0xb7,0xf8,0xff,0xcc,0x0a,0x43,0xc8,
+	0xfd,0xff,0xff,0xff,0xff,0xed,0x8e,0x0f,0x00,0x00,0x00,0x0e,0x2f,0x40,0x3d,0x24,
+	0x03,0x00,0x00,0x00,0x00,0x00,0x00,0xaa,0xa6,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x09,0xf5,0xb2,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4c,0xff,0xb2,0x00,0x00,0x00,
+	0x00,0x00,0x06,0x5e,0xd8,0xff,0xdd,0x8f,0x8f,0x8f,0x83,0x00,0x93,0xff,0xff,0xff,
+	0xff,0xff,0xff,0xff,0xe9,0x00,0x1c,0x30,0x99,0xff,0xc0,0x30,0x30,0x30,0x2c,0x00,
+	0x00,0x00,0x81,0xff,0xb2,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x81,0xff,0xb2,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x81,0xff,0xb2,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x81,0xff,0xb2,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x81,0xff,0xb2,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x81,0xff,0xb2,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x81,0xff,
+	0xb2,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x81,0xff,0xb3,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x76,0xff,0xcd,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4b,0xff,0xfd,0x38,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x06,0xdd,0xff,0xf6,0xa5,0x93,0xb4,0x04,0x00,0x00,
+	0x00,0x29,0xce,0xff,0xff,0xff,0xf9,0x05,0x00,0x00,0x00,0x00,0x00,0x21,0x3f,0x36,
+	0x0d,0x00
+};
+#endif
@@ -0,0 +1,238 @@
+// generated by build_tools/fontgen.py - do not edit
+// 40px VLW font from OpenSans_Regular.h: "0123456789"
+// Add #define OPENSANS_DIGITS_IMPLEMENTATION
+// to exactly one CPP file before including this file
+#ifndef OPENSANS_DIGITS_H
+#define OPENSANS_DIGITS_H
+#include <stdint.h>
+
+extern const uint8_t OpenSans_digits[3567];
+#endif
+#ifdef OPENSANS_DIGITS_IMPLEMENTATION
+
+const uint8_t OpenSans_digits[3567] = {
+	0x00,0x00,0x00,0x0a,0x00,0x00,0x00,0x0b,0x00,0x00,0x00,0x28,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x1f,0x00,0x00,0x00,0x09,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x17,
+	0x00,0x00,0x00,0x0f,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x16,0x00,0x00,0x00,0x01,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x31,0x00,0x00,0x00,0x15,0x00,0x00,0x00,0x09,
+	0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x15,0x00,0x00,0x00,0x02,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x32,0x00,0x00,0x00,0x16,0x00,0x00,0x00,0x0f,0x00,0x00,0x00,0x11,
+	0x00,0x00,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x33,
+	0x00,0x00,0x00,0x17,0x00,0x00,0x00,0x0f,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x16,
+	0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x34,0x00,0x00,0x00,0x16,
+	0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x16,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x35,0x00,0x00,0x00,0x16,0x00,0x00,0x00,0x0f,
+	0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x15,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x36,0x00,0x00,0x00,0x17,0x00,0x00,0x00,0x0f,0x00,0x00,0x00,0x11,
+	0x00,0x00,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x37,
+	0x00,0x00,0x00,0x15,0x00,0x00,0x00,0x0f,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x15,
+	0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x17,
+	0x00,0x00,0x00,0x0f,0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x16,0x00,0x00,0x00,0x01,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x39,0x00,0x00,0x00,0x17,0x00,0x00,0x00,0x0f,
+	0x00,0x00,0x00,0x11,0x00,0x00,0x00,0x16,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x10,0x3c,0x48,0x33,0x05,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x24,0xb0,0xfc,0xff,0xff,0xff,0xef,0x82,0x07,0x00,0x00,0x00,0x00,0x00,
+	0x32,0xee,0xff,0xff,0xe1,0xcb,0xec,0xff,0xff,0xbe,0x07,0x00,0x00,0x00,0x09,0xdd,
+	0xff,0xe3,0x3e,0x00,0x00,0x04,0x64,0xf7,0xff,0x8e,0x00,0x00,0x00,0x6b,0xff,0xfb,
+	0x33,0x00,0x00,0x00,0x00,0x00,0x6c,0xff,0xfb,0x1f,0x00,0x00,0xc9,0xff,0xac,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x04,0xe5,0xff,0x80,0x00,0x10,0xfd,0xff,0x5c,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x9a,0xff,0xcb,0x00,0x3f,0xff,0xff,0x28,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x65,0xff,0xfa,0x07,0x61,0xff,0xfe,0x07,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x42,0xff,0xff,0x28,0x77,0xff,0xef,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x2c,0xff,0xff,0x41,0x84,0xff,0xe4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x20,0xff,0xff,0x4f,0x88,0xff,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x1c,0xff,0xff,0x53,0x83,0xff,0xe4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x21,
+	0xff,0xff,0x4f,0x75,0xff,0xf0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2d,0xff,
+	0xff,0x42,0x5d,0xff,0xfe,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0xff,0xff,
+	0x2b,0x37,0xff,0xff,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x66,0xff,0xfd,0x0a,
+	0x09,0xf8,0xff,0x5e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9b,0xff,0xd5,0x00,0x00,
+	0xb7,0xff,0xad,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0xe6,0xff,0x8f,0x00,0x00,0x53,
+	0xff,0xfb,0x34,0x00,0x00,0x00,0x00,0x00,0x6e,0xff,0xff,0x31,0x00,0x00,0x01,0xc5,
+	0xff,0xe4,0x3e,0x00,0x00,0x04,0x64,0xf8,0xff,0xa9,0x00,0x00,0x00,0x00,0x1e,0xdf,
+	0xff,0xff,0xe0,0xcb,0xec,0xff,0xff,0xd1,0x11,0x00,0x00,0x00,0x00,0x00,0x16,0xa0,
+	0xf9,0xff,0xff,0xff,0xf2,0x8f,0x0e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0b,
+	0x38,0x42,0x32,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x64,0xeb,
+	0xef,0x3d,0x00,0x00,0x00,0x09,0x9e,0xff,0xff,0xff,0x41,0x00,0x00,0x23,0xcf,0xff,
+	0xe7,0xfb,0xff,0x41,0x00,0x4e,0xef,0xff,0xd4,0x24,0xfe,0xff,0x41,0x18,0xf6,0xff,
+	0xb1,0x0d,0x0b,0xff,0xff,0x41,0x00,0x64,0x83,0x02,0x00,0x10,0xff,0xff,0x41,0x00,
+	0x00,0x00,0x00,0x00,0x12,0xff,0xff,0x41,0x00,0x00,0x00,0x00,0x00,0x12,0xff,0xff,
+	0x41,0x00,0x00,0x00,0x00,0x00,0x12,0xff,0xff,0x41,0x00,0x00,0x00,0x00,0x00,0x12,
+	0xff,0xff,0x41,0x00,0x00,0x00,0x00,0x00,0x12,0xff,0xff,0x41,0x00,0x00,0x00,0x00,
+	0x00,0x12,0xff,0xff,0x41,0x00,0x00,0x00,0x00,0x00,0x12,0xff,0xff,0x41,0x00,0x00,
+	0x00,0x00,0x00,0x12,0xff,0xff,0x41,0x00,0x00,0x00,0x00,0x00,0x12,0xff,0xff,0x41,
+	0x00,0x00,0x00,0x00,0x00,0x12,0xff,0xff,0x41,0x00,0x00,0x00,0x00,0x00,0x12,0xff,
+	0xff,0x41,0x00,0x00,0x00,0x00,0x00,0x12,0xff,0xff,0x41,0x00,0x00,0x00,0x00,0x00,
+	0x12,0xff,0xff,0x41,0x00,0x00,0x00,0x00,0x00,0x12,0xff,0xff,0x41,0x00,0x00,0x00,
+	0x00,0x00,0x12,0xff,0xff,0x41,0x00,0x00,0x00,0x00,0x01,0x22,0x3f,0x3f,0x24,0x02,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1d,0x8f,0xe7,0xff,0xff,0xff,0xff,0xe8,0x84,
+	0x0a,0x00,0x00,0x00,0x01,0x73,0xf6,0xff,0xff,0xf0,0xd0,0xcf,0xf4,0xff,0xff,0xce,
+	0x0f,0x00,0x00,0x15,0xe8,0xff,0xb9,0x3f,0x03,0x00,0x00,0x0a,0x7e,0xfe,0xff,0x9f,
+	0x00,0x00,0x00,0x3f,0x5f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x99,0xff,0xfb,0x11,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3a,0xff,0xff,0x41,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x22,0xff,0xff,0x4e,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x39,0xff,0xff,0x35,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0xff,0xf0,0x07,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x0a,0xe5,0xff,0x94,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x8d,0xff,0xf1,0x1a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x55,0xfe,0xff,0x5d,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x41,0xf7,0xff,0x8f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x38,
+	0xf2,0xff,0xa9,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x35,0xf0,0xff,
+	0xb0,0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x34,0xef,0xff,0xad,0x06,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x33,0xee,0xff,0xa9,0x05,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x32,0xee,0xff,0xa4,0x03,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x32,0xed,0xff,0x9f,0x03,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x30,0xed,0xff,0xc3,0x32,0x30,0x30,0x30,0x30,0x30,0x30,0x30,0x30,
+	0x30,0x0a,0x90,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+	0x37,0x90,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x37,
+	0x00,0x00,0x00,0x00,0x05,0x27,0x3f,0x40,0x27,0x04,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x01,0x4d,0xb1,0xf5,0xff,0xff,0xff,0xff,0xf0,0x9b,0x1a,0x00,0x00,0x00,0x25,0xc6,
+	0xff,0xff,0xff,0xea,0xcd,0xcd,0xf2,0xff,0xff,0xea,0x2c,0x00,0x00,0x26,0xf2,0xf0,
+	0x84,0x25,0x00,0x00,0x00,0x06,0x65,0xfa,0xff,0xd1,0x02,0x00,0x00,0x3d,0x16,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x78,0xff,0xff,0x39,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x25,0xff,0xff,0x62,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x19,0xff,0xff,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x55,0xff,0xff,0x34,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x17,0xda,0xff,0xc9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x12,0x62,
+	0xe2,0xff,0xde,0x23,0x00,0x00,0x00,0x00,0x00,0x65,0xdf,0xdf,0xe8,0xff,0xff,0xd7,
+	0x7f,0x0e,0x00,0x00,0x00,0x00,0x00,0x00,0x74,0xff,0xff,0xff,0xff,0xff,0xdc,0xa2,
+	0x41,0x00,0x00,0x00,0x00,0x00,0x00,0x16,0x30,0x30,0x3a,0x51,0x81,0xd6,0xff,0xff,
+	0x9c,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x7a,0xff,0xff,
+	0x6a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xb9,0xff,0xd6,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x71,0xff,0xfd,0x06,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6e,0xff,0xff,0x0b,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x9f,0xff,0xe9,0x00,0x04,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0xf6,0xff,0x9d,0x00,0x9d,0x9f,0x4b,
+	0x0d,0x00,0x00,0x00,0x00,0x09,0x5e,0xe9,0xff,0xf1,0x22,0x00,0xa6,0xff,0xff,0xfe,
+	0xde,0xc6,0xbf,0xd2,0xf8,0xff,0xff,0xea,0x3d,0x00,0x00,0x30,0x9c,0xe5,0xff,0xff,
+	0xff,0xff,0xff,0xff,0xdc,0x83,0x14,0x00,0x00,0x00,0x00,0x00,0x00,0x1b,0x37,0x42,
+	0x44,0x38,0x15,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x07,0x10,0x10,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x07,0xcf,0xff,0xff,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x8a,0xff,0xff,0xff,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x40,0xfd,0xd9,0xff,0xff,0x18,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x10,0xe1,0xff,0x5b,0xff,0xff,0x18,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0xa5,0xff,0xaa,0x23,0xff,0xff,0x18,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x59,0xff,0xe7,0x14,0x2a,0xff,0xff,0x18,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x1d,0xee,0xfe,0x49,0x00,0x2e,0xff,0xff,0x18,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x02,0xbe,0xff,0x93,0x00,0x00,0x2f,0xff,0xff,0x18,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x73,0xff,0xd6,0x09,0x00,0x00,0x2f,0xff,0xff,0x18,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x2e,0xf8,0xf9,0x32,0x00,0x00,0x00,0x2f,0xff,0xff,
+	0x18,0x00,0x00,0x00,0x00,0x00,0x08,0xd3,0xff,0x78,0x00,0x00,0x00,0x00,0x2f,0xff,
+	0xff,0x18,0x00,0x00,0x00,0x00,0x00,0x8e,0xff,0xc1,0x02,0x00,0x00,0x00,0x00,0x2f,
+	0xff,0xff,0x18,0x00,0x00,0x00,0x00,0x44,0xfd,0xf0,0x1f,0x00,0x00,0x00,0x00,0x00,
+	0x2f,0xff,0xff,0x18,0x00,0x00,0x00,0x12,0xe3,0xff,0x5c,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x2f,0xff,0xff,0x18,0x00,0x00,0x00,0x61,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+	0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x35,0x62,0xff,0xff,0xff,0xff,0xff,0xff,
+	0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x35,0x12,0x30,0x30,0x30,0x30,0x30,
+	0x30,0x30,0x30,0x30,0x56,0xff,0xff,0x43,0x30,0x30,0x0a,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x2f,0xff,0xff,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x2f,0xff,0xff,0x18,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2f,0xff,0xff,0x18,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2f,0xff,0xff,0x18,0x00,0x00,0x00,0x00,
+	0x00,0xc9,0xef,0xef,0xef,0xef,0xef,0xef,0xef,0xef,0xef,0x95,0x00,0x00,0x00,0x00,
+	0xeb,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x9f,0x00,0x00,0x00,0x03,0xfc,
+	0xff,0x66,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x28,0x00,0x00,0x00,0x15,0xff,0xff,
+	0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0xff,0xff,0x0b,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3e,0xff,0xf5,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x52,0xff,0xdf,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x67,0xff,0xca,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7b,0xff,0xdc,0x9c,0xb9,0xcc,0xc7,0xb2,
+	0x81,0x2e,0x00,0x00,0x00,0x00,0x00,0x8b,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+	0xfe,0xa7,0x10,0x00,0x00,0x00,0x09,0x7d,0x7e,0x59,0x41,0x3d,0x4a,0x78,0xd1,0xff,
+	0xff,0xc9,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x85,0xff,
+	0xff,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xc7,0xff,
+	0xd9,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x74,0xff,0xff,
+	0x0b,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5b,0xff,0xff,0x16,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6b,0xff,0xfc,0x07,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xae,0xff,0xcf,0x00,0x03,0x02,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x43,0xfd,0xff,0x72,0x00,0x18,0xd4,0x6a,
+	0x1f,0x00,0x00,0x00,0x00,0x12,0x78,0xf6,0xff,0xd2,0x08,0x00,0x18,0xff,0xff,0xff,
+	0xed,0xd0,0xc6,0xd9,0xfd,0xff,0xff,0xcf,0x1b,0x00,0x00,0x04,0x71,0xd0,0xfd,0xff,
+	0xff,0xff,0xff,0xff,0xd3,0x6e,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0x30,0x40,
+	0x44,0x39,0x14,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x03,0x25,0x3f,0x40,0x32,0x0c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x38,0xa9,0xf2,
+	0xff,0xff,0xff,0xff,0xbd,0x00,0x00,0x00,0x00,0x00,0x04,0x94,0xfe,0xff,0xff,0xde,
+	0xbc,0xb6,0xca,0xb5,0x00,0x00,0x00,0x00,0x01,0xa6,0xff,0xfe,0x9d,0x24,0x00,0x00,
+	0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x66,0xff,0xfe,0x60,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x09,0xe9,0xff,0x94,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x5d,0xff,0xf8,0x16,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0xad,0xff,0xb3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0xe9,0xff,0x73,0x00,0x00,0x00,0x04,0x0d,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x15,0xff,0xff,0x48,0x0d,0x81,0xd8,0xfe,0xff,0xf4,0xb9,0x49,0x00,0x00,0x00,0x34,
+	0xff,0xff,0x47,0xd8,0xff,0xf7,0xd8,0xe1,0xfc,0xff,0xff,0x8c,0x00,0x00,0x46,0xff,
+	0xff,0xe0,0xe7,0x5d,0x09,0x00,0x00,0x1b,0xa1,0xff,0xff,0x5f,0x00,0x4f,0xff,0xff,
+	0xe8,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0xb6,0xff,0xde,0x01,0x4e,0xff,0xff,0x6a,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x43,0xff,0xff,0x2b,0x41,0xff,0xff,0x2a,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x10,0xff,0xff,0x50,0x23,0xff,0xff,0x31,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x03,0xff,0xff,0x58,0x02,0xee,0xff,0x5e,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x18,0xff,0xff,0x46,0x00,0xa5,0xff,0xb9,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x53,0xff,0xfe,0x19,0x00,0x3b,0xff,0xff,0x54,0x00,0x00,0x00,0x00,
+	0x00,0x03,0xc8,0xff,0xc6,0x00,0x00,0x00,0xa5,0xff,0xf9,0x69,0x05,0x00,0x00,0x1b,
+	0xb0,0xff,0xfe,0x43,0x00,0x00,0x00,0x0a,0xc0,0xff,0xff,0xed,0xc6,0xd2,0xfb,0xff,
+	0xfe,0x74,0x00,0x00,0x00,0x00,0x00,0x06,0x7b,0xe8,0xff,0xff,0xff,0xff,0xc8,0x46,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x2d,0x43,0x3d,0x17,0x00,0x00,0x00,
+	0x00,0x00,0x9c,0xef,0xef,0xef,0xef,0xef,0xef,0xef,0xef,0xef,0xef,0xef,0xef,0xef,
+	0x48,0xa6,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x4d,
+	0x2a,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x40,0x8d,0xff,0xf6,0x16,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xce,0xff,0x99,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x46,0xff,0xfd,0x28,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xbc,0xff,0xb3,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x33,0xff,0xff,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0xa9,0xff,0xcc,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x23,0xfc,0xff,0x59,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x96,0xff,0xe1,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x16,
+	0xf6,0xff,0x73,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x83,0xff,
+	0xf1,0x0e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0c,0xed,0xff,0x8d,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x70,0xff,0xfb,0x1e,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x05,0xe1,0xff,0xa6,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x5d,0xff,0xff,0x33,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xd2,0xff,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x4b,0xff,0xff,0x4d,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0x00,0xc1,0xff,0xd7,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x38,0xff,0xff,0x66,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0xae,0xff,0xea,0x09,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x13,0x37,0x40,0x34,0x0d,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x51,
+	0xca,0xff,0xff,0xff,0xff,0xfb,0xb9,0x39,0x00,0x00,0x00,0x00,0x00,0x8a,0xff,0xff,
+	0xf4,0xbe,0xb0,0xcb,0xfc,0xff,0xfc,0x5c,0x00,0x00,0x00,0x46,0xff,0xff,0xa0,0x0c,
+	0x00,0x00,0x00,0x21,0xcb,0xff,0xf5,0x1c,0x00,0x00,0xa7,0xff,0xd6,0x05,0x00,0x00,
+	0x00,0x00,0x00,0x1d,0xfb,0xff,0x6f,0x00,0x00,0xca,0xff,0x96,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x00,0xd2,0xff,0x91,0x00,0x00,0xbd,0xff,0xa2,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0xde,0xff,0x83,0x00,0x00,0x7e,0xff,0xec,0x14,0x00,0x00,0x00,0x00,0x00,
+	0x3b,0xfe,0xff,0x3a,0x00,0x00,0x14,0xec,0xff,0xc3,0x18,0x00,0x00,0x00,0x26,0xde,
+	0xff,0xa7,0x00,0x00,0x00,0x00,0x3e,0xf1,0xff,0xf0,0x7a,0x23,0x81,0xf6,0xff,0xad,
+	0x08,0x00,0x00,0x00,0x00,0x00,0x2a,0xc9,0xff,0xff,0xff,0xff,0xe9,0x5e,0x01,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x36,0xc3,0xff,0xff,0xff,0xff,0xfb,0x9c,0x16,0x00,0x00,
+	0x00,0x00,0x00,0x77,0xfc,0xff,0xbb,0x38,0x41,0xae,0xfd,0xff,0xeb,0x43,0x00,0x00,
+	0x00,0x6b,0xff,0xfd,0x6c,0x00,0x00,0x00,0x00,0x34,0xd3,0xff,0xf7,0x38,0x00,0x13,
+	0xf4,0xff,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0xdd,0xff,0xce,0x00,0x5e,0xff,
+	0xfa,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x54,0xff,0xff,0x23,0x7c,0xff,0xdf,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0xff,0xff,0x40,0x70,0xff,0xf1,0x02,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x34,0xff,0xff,0x31,0x3b,0xff,0xff,0x54,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x9a,0xff,0xee,0x05,0x01,0xca,0xff,0xf1,0x57,0x02,
+	0x00,0x00,0x00,0x0a,0x87,0xff,0xff,0x7b,0x00,0x00,0x22,0xe0,0xff,0xff,0xe9,0xb8,
+	0xad,0xbf,0xf5,0xff,0xff,0xa6,0x04,0x00,0x00,0x00,0x10,0x88,0xe5,0xff,0xff,0xff,
+	0xff,0xff,0xce,0x5c,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x20,0x3e,0x43,0x3b,
+	0x15,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x16,0x39,0x3f,0x21,0x00,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x48,0xc8,0xff,0xff,0xff,0xff,0xdc,0x66,
+	0x01,0x00,0x00,0x00,0x00,0x00,0x7c,0xff,0xff,0xfb,0xd7,0xd1,0xf5,0xff,0xff,0xa8,
+	0x03,0x00,0x00,0x00,0x52,0xff,0xff,0xa6,0x19,0x00,0x00,0x0c,0x80,0xfd,0xff,0x85,
+	0x00,0x00,0x01,0xda,0xff,0xb6,0x01,0x00,0x00,0x00,0x00,0x00,0x6f,0xff,0xfa,0x1f,
+	0x00,0x32,0xff,0xff,0x3b,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0xcf,0xff,0x86,0x00,
+	0x62,0xff,0xf7,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x74,0xff,0xd1,0x00,0x75,
+	0xff,0xe4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x46,0xff,0xfc,0x09,0x70,0xff,
+	0xef,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3d,0xff,0xff,0x25,0x4e,0xff,0xff,
+	0x22,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7a,0xff,0xff,0x34,0x0f,0xf7,0xff,0x94,
+	0x00,0x00,0x00,0x00,0x00,0x00,0x29,0xee,0xff,0xff,0x35,0x00,0x8a,0xff,0xfe,0x86,
+	0x11,0x00,0x00,0x0d,0x67,0xec,0xe5,0xff,0xff,0x2c,0x00,0x06,0xb5,0xff,0xff,0xfa,
+	0xdc,0xda,0xf9,0xff,0xc9,0x54,0xff,0xff,0x19,0x00,0x00,0x03,0x66,0xcc,0xfc,0xff,
+	0xfe,0xd4,0x72,0x05,0x61,0xff,0xf8,0x03,0x00,0x00,0x00,0x00,0x00,0x08,0x12,0x09,
+	0x00,0x00,0x00,0x8b,0xff,0xcf,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0xca,0xff,0x94,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+	0x27,0xfe,0xff,0x44,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xaa,
+	0xff,0xd9,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x71,0xff,0xff,
+	0x50,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x29,0xa6,0xff,0xff,0x94,0x00,
+	0x00,0x00,0x00,0x00,0xe2,0xc3,0xb0,0xb9,0xde,0xff,0xff,0xfd,0x88,0x02,0x00,0x00,
+	0x00,0x00,0x00,0xf1,0xff,0xff,0xff,0xff,0xf2,0xa6,0x33,0x00,0x00,0x00,0x00,0x00,
+	0x00,0x00,0x15,0x3b,0x44,0x3f,0x27,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+};
+#endif
@@ -6,12 +6,33 @@
 // the number of alarms
 static constexpr const size_t alarm_count = 4;
 
+// the serial protocol version. version 1 only has the 8-bit alarm id commands.
+// version 2 adds HELLO and the 16-bit forms. each side sends HELLO on startup
+// and only uses the 16-bit forms once the other side has answered with 2 or
+// better. multi-byte values are LSB first
+static constexpr const uint8_t protocol_version = 2;
+
 enum COMMAND_ID : uint8_t {
     SET_ALARM = 1, // followed by 1 byte, alarm id
     CLEAR_ALARM = 2, // followed by 1 byte, alarm id
-    ALARM_THROWN = 3 // followed by 1 byte, alarm id
+    ALARM_THROWN = 3, // followed by 1 byte, alarm id
+    SET_ALARMS = 4, // followed by 1 byte, first alarm id, 1 byte, alarm count,
+                    // and (count+7)/8 bytes of alarm states, LSB first
+    // version 2
+    HELLO = 5, // followed by 1 byte, protocol version, 1 byte, 1 if the
+               // receiver should answer with its own HELLO
+    SET_ALARM16 = 6, // followed by 2 bytes, alarm id
+    CLEAR_ALARM16 = 7, // followed by 2 bytes, alarm id
+    ALARM_THROWN16 = 8, // followed by 2 bytes, alarm id
+    SET_ALARMS16 = 9 // followed by 2 bytes, first alarm id, 2 bytes, alarm
+                     // count, and (count+7)/8 bytes of alarm states
 };
 
+// the most alarms a single SET_ALARMS or SET_ALARMS16 frame carries
+static constexpr const size_t set_alarms_max_count = 248;
+
+static_assert(alarm_count <= 65536, "alarm ids must fit in 16 bits");
+
 // The fire alarm switches - must have <alarm_count> entries
 static constexpr uint8_t alarm_switch_pins[alarm_count] = {
     27,14,12,13
@@ -0,0 +1,41 @@
+#ifndef DEBOUNCE_H
+#define DEBOUNCE_H
+#include <stdint.h>
+#include <stddef.h>
+
+// Debounces a word's worth of inputs at once with 2-bit vertical counters,
+// one per input, sliced across two words. Each counts the samples an input
+// has disagreed with its debounced state, and is reset by any sample that
+// agrees, so an input has to read the same for four samples in a row before
+// it counts as changed. The cost per sample is a handful of word operations
+// no matter how many inputs changed.
+
+template <typename Word>
+struct debounce_word {
+    // the debounced state, one bit per input
+    Word state;
+    // the low and high bits of each input's counter
+    Word lo;
+    Word hi;
+};
+// starts every input debounced as off, with its counter reset
+template <typename Word>
+static inline void debounce_init(debounce_word<Word>* word) {
+    word->state = 0;
+    word->lo = (Word)~(Word)0;
+    word->hi = (Word)~(Word)0;
+}
+// runs the counters with a new sample. returns the inputs that just settled
+// into a new state
+template <typename Word>
+static inline Word debounce(debounce_word<Word>* word, Word sample) {
+    Word changed = word->state ^ sample;
+    word->lo = (Word)~(word->lo & changed);
+    word->hi = (Word)(word->lo ^ (word->hi & changed));
+    // the counters that rolled over
+    changed &= word->lo & word->hi;
+    word->state ^= changed;
+    return changed;
+}
+
+#endif
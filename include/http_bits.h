@@ -0,0 +1,52 @@
+#ifndef HTTP_BITS_H
+#define HTTP_BITS_H
+#include <stdint.h>
+#include <stddef.h>
+
+// The /api/bits body: the state version as 4 bytes, then the alarms one bit
+// each, (count+7)/8 bytes of them, all little endian. Alarm 0 is the low bit
+// of the byte after the version.
+
+// the size of the body for <count> alarms
+static constexpr inline size_t http_bits_size(size_t count) {
+    return 4 + (count + 7) / 8;
+}
+// writes <version> and the first <count> alarms of the packed <values> into
+// <out_body>, which holds http_bits_size(count) bytes
+static inline void http_bits_encode(uint32_t version, const uint32_t* values,
+                                    size_t count, uint8_t* out_body) {
+    for (size_t i = 0; i < 4; ++i) {
+        out_body[i] = (uint8_t)(version >> (i * 8));
+    }
+    uint8_t* mask = out_body + 4;
+    const size_t mask_size = (count + 7) / 8;
+    for (size_t i = 0; i < mask_size; ++i) {
+        mask[i] = (uint8_t)(values[i / 4] >> ((i % 4) * 8));
+    }
+    if (count % 8) {
+        // whatever is past the last alarm goes out clear
+        mask[mask_size - 1] &= (uint8_t)((1 << (count % 8)) - 1);
+    }
+}
+// reads <body>, which holds http_bits_size(count) bytes, into <out_version>
+// and the packed <out_values>, which holds (count+31)/32 words. bits past
+// the last alarm come out clear
+static inline void http_bits_decode(const uint8_t* body, size_t count,
+                                    uint32_t* out_version,
+                                    uint32_t* out_values) {
+    *out_version = (uint32_t)body[0] | ((uint32_t)body[1] << 8) |
+                   ((uint32_t)body[2] << 16) | ((uint32_t)body[3] << 24);
+    const uint8_t* mask = body + 4;
+    const size_t mask_size = (count + 7) / 8;
+    for (size_t i = 0; i < (count + 31) / 32; ++i) {
+        out_values[i] = 0;
+    }
+    for (size_t i = 0; i < mask_size; ++i) {
+        out_values[i / 4] |= (uint32_t)mask[i] << ((i % 4) * 8);
+    }
+    if (count % 32) {
+        out_values[(count - 1) / 32] &= (UINT32_C(1) << (count % 32)) - 1;
+    }
+}
+
+#endif
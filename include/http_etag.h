@@ -0,0 +1,55 @@
+#ifndef HTTP_ETAG_H
+#define HTTP_ETAG_H
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+
+// Entity tags for the alarm state. A tag is the state version plus a value
+// picked at boot, so a tag from before a reboot never matches, even though
+// the version starts over.
+
+// the space a tag takes, including the quotes and the terminator
+static constexpr const size_t http_etag_size = 24;
+// formats the tag for <version> into <out_etag>, which holds http_etag_size
+// characters
+static inline void http_etag_format(uint32_t boot, uint32_t version,
+                                    char* out_etag) {
+    snprintf(out_etag, http_etag_size, "\"%08x-%x\"", (unsigned)boot,
+             (unsigned)version);
+}
+// true if the If-None-Match value <header> lists <etag>, or is "*". weak
+// tags (W/"...") compare the same as strong ones, as If-None-Match wants
+static inline bool http_etag_match(const char* header, const char* etag) {
+    const size_t etag_size = strlen(etag);
+    const char* p = header;
+    while (*p) {
+        while (*p == ' ' || *p == '\t' || *p == ',') {
+            ++p;
+        }
+        if (*p == '\0') {
+            break;
+        }
+        const char* begin = p;
+        while (*p && *p != ',') {
+            ++p;
+        }
+        const char* end = p;
+        while (end > begin && (end[-1] == ' ' || end[-1] == '\t')) {
+            --end;
+        }
+        if (end - begin == 1 && *begin == '*') {
+            return true;
+        }
+        if (end - begin > 2 && begin[0] == 'W' && begin[1] == '/') {
+            begin += 2;
+        }
+        if ((size_t)(end - begin) == etag_size &&
+            0 == memcmp(begin, etag, etag_size)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+#endif
@@ -0,0 +1,160 @@
+#ifndef HTTP_QUERY_H
+#define HTTP_QUERY_H
+#include <stdint.h>
+#include <stddef.h>
+
+// Walks a URL query string in place. Names and values come back as views
+// into the URL, still percent encoded, and are only decoded as they're
+// compared or parsed, so nothing is copied and nothing is cut short.
+
+// a still encoded run of characters within the URL
+struct http_query_part {
+    const char* begin;
+    size_t size;
+};
+struct http_query_param {
+    http_query_part name;
+    http_query_part value;
+};
+
+// finds the next name[=value] pair, starting at <query>, which may point at
+// the '?' or '&' before it, and stops at the end of the string or a '#'.
+// returns where to continue from, or nullptr when there are no more
+static inline const char* http_query_next(const char* query,
+                                          http_query_param* out_param) {
+    if (query == nullptr) {
+        return nullptr;
+    }
+    // skip separators, including empty pairs like "&&"
+    while (*query == '?' || *query == '&') {
+        ++query;
+    }
+    if (*query == '\0' || *query == '#') {
+        return nullptr;
+    }
+    out_param->name.begin = query;
+    while (*query && *query != '=' && *query != '&' && *query != '#') {
+        ++query;
+    }
+    out_param->name.size = query - out_param->name.begin;
+    if (*query == '=') {
+        ++query;
+    }
+    out_param->value.begin = query;
+    while (*query && *query != '&' && *query != '#') {
+        ++query;
+    }
+    out_param->value.size = query - out_param->value.begin;
+    return query;
+}
+
+static inline int http_query_hex(char ch) {
+    if (ch >= '0' && ch <= '9') return ch - '0';
+    if (ch >= 'a' && ch <= 'f') return ch - 'a' + 10;
+    if (ch >= 'A' && ch <= 'F') return ch - 'A' + 10;
+    return -1;
+}
+// decodes the next character of <in_out_part>, advancing past it. %XX is
+// the byte it names, '+' is a space, and a '%' that isn't followed by two hex
+// digits stands for itself. returns -1 at the end
+static inline int http_query_getc(http_query_part* in_out_part) {
+    if (in_out_part->size == 0) {
+        return -1;
+    }
+    const char* p = in_out_part->begin;
+    if (*p == '%' && in_out_part->size >= 3) {
+        const int hi = http_query_hex(p[1]);
+        const int lo = http_query_hex(p[2]);
+        if (hi > -1 && lo > -1) {
+            in_out_part->begin += 3;
+            in_out_part->size -= 3;
+            return (hi << 4) | lo;
+        }
+    }
+    ++in_out_part->begin;
+    --in_out_part->size;
+    return *p == '+' ? ' ' : (unsigned char)*p;
+}
+// the decoded character <in_out_part> starts with, without advancing
+static inline int http_query_peek(const http_query_part* part) {
+    http_query_part copy = *part;
+    return http_query_getc(&copy);
+}
+
+// true if <part> decodes to exactly <value>
+static inline bool http_query_equals(http_query_part part, const char* value) {
+    while (*value) {
+        if (http_query_getc(&part) != (unsigned char)*value++) {
+            return false;
+        }
+    }
+    return part.size == 0;
+}
+// reads a run of decimal digits off the front of <in_out_part>. returns
+// false if there are none or the number doesn't fit in 32 bits
+static inline bool http_query_read_uint(http_query_part* in_out_part,
+                                        uint32_t* out_value) {
+    uint32_t result = 0;
+    size_t digits = 0;
+    int ch;
+    while ((ch = http_query_peek(in_out_part)) >= '0' && ch <= '9') {
+        if (result > (UINT32_MAX - (ch - '0')) / 10) {
+            return false;
+        }
+        result = result * 10 + (ch - '0');
+        ++digits;
+        http_query_getc(in_out_part);
+    }
+    if (digits == 0) {
+        return false;
+    }
+    *out_value = result;
+    return true;
+}
+// true if all of <part> is an unsigned 32-bit decimal number
+static inline bool http_query_uint(http_query_part part, uint32_t* out_value) {
+    uint32_t result;
+    if (!http_query_read_uint(&part, &result) || part.size != 0) {
+        return false;
+    }
+    *out_value = result;
+    return true;
+}
+// takes the next item off a list like 3,7,10-20, advancing <in_out_list>
+// past it. a single number comes back as a range of one. returns false at
+// the end of the list, and sets <out_error> if the item is malformed
+static inline bool http_query_next_range(http_query_part* in_out_list,
+                                         uint32_t* out_first,
+                                         uint32_t* out_last, bool* out_error) {
+    *out_error = false;
+    if (in_out_list->size == 0) {
+        return false;
+    }
+    if (!http_query_read_uint(in_out_list, out_first)) {
+        *out_error = true;
+        return false;
+    }
+    *out_last = *out_first;
+    int ch = http_query_getc(in_out_list);
+    if (ch == '-') {
+        if (!http_query_read_uint(in_out_list, out_last) ||
+            *out_last < *out_first) {
+            *out_error = true;
+            return false;
+        }
+        ch = http_query_getc(in_out_list);
+    }
+    if (ch == ',') {
+        // a trailing comma is a missing item
+        if (in_out_list->size == 0) {
+            *out_error = true;
+            return false;
+        }
+    } else if (ch != -1) {
+        *out_error = true;
+        return false;
+    }
+    return true;
+}
+
+#endif
@@ -0,0 +1,79 @@
+#ifndef HTTP_SEND_BUFFER_H
+#define HTTP_SEND_BUFFER_H
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+// Collects a response so it goes out a TCP segment at a time, rather than
+// one socket send per block or expression. The bytes sent are exactly the
+// bytes written, just in fewer, bigger pieces.
+
+// sends <size> bytes of <data> down the connection
+typedef void (*http_send_buffer_send_t)(const char* data, size_t size,
+                                        void* state);
+struct http_send_buffer {
+    http_send_buffer_send_t send;
+    void* state;
+    char* data;
+    size_t capacity;
+    size_t size;
+};
+// sets up <buffer> to collect into <data>, which holds <capacity> bytes
+static inline void http_send_buffer_init(http_send_buffer* buffer, char* data,
+                                         size_t capacity,
+                                         http_send_buffer_send_t send,
+                                         void* state) {
+    buffer->send = send;
+    buffer->state = state;
+    buffer->data = data;
+    buffer->capacity = capacity;
+    buffer->size = 0;
+}
+// sends whatever has been collected so far
+static inline void http_send_buffer_flush(http_send_buffer* buffer) {
+    if (buffer->size) {
+        buffer->send(buffer->data, buffer->size, buffer->state);
+        buffer->size = 0;
+    }
+}
+// adds <data> to the response, sending each time the buffer fills
+static inline void http_send_buffer_write(http_send_buffer* buffer,
+                                          const char* data, size_t size) {
+    while (size) {
+        size_t avail = buffer->capacity - buffer->size;
+        if (avail > size) {
+            avail = size;
+        }
+        memcpy(buffer->data + buffer->size, data, avail);
+        buffer->size += avail;
+        data += avail;
+        size -= avail;
+        if (buffer->size == buffer->capacity) {
+            http_send_buffer_flush(buffer);
+        }
+    }
+}
+// adds <data> as one chunk of a chunked response. an empty chunk is the
+// terminator that ends the response
+static inline void http_send_buffer_chunk(http_send_buffer* buffer,
+                                          const char* data, size_t size) {
+    if (data == nullptr || size == 0) {
+        http_send_buffer_write(buffer, "0\r\n\r\n", 5);
+        return;
+    }
+    // the length in hex, filled in from the last digit back
+    char header[sizeof(size_t) * 2 + 2];
+    size_t i = sizeof(header) - 2;
+    header[i] = '\r';
+    header[i + 1] = '\n';
+    size_t length = size;
+    do {
+        header[--i] = "0123456789ABCDEF"[length & 0xF];
+        length >>= 4;
+    } while (length);
+    http_send_buffer_write(buffer, header + i, sizeof(header) - i);
+    http_send_buffer_write(buffer, data, size);
+    http_send_buffer_write(buffer, "\r\n", 2);
+}
+
+#endif
@@ -4,7 +4,7 @@
 #define HTTPD_CONTENT_H
 
 
-#define HTTPD_RESPONSE_HANDLER_COUNT 7
+#define HTTPD_RESPONSE_HANDLER_COUNT 4
 typedef struct { const char* path; const char* path_encoded; void (* handler) (void* arg); } httpd_response_handler_t;
 extern httpd_response_handler_t httpd_response_handlers[HTTPD_RESPONSE_HANDLER_COUNT];
 #ifdef __cplusplus
@@ -13,8 +13,6 @@ extern "C" {
 
 // ./index.clasp
 void httpd_content_index_clasp(void* resp_arg);
-// ./api/index.clasp
-void httpd_content_api_index_clasp(void* resp_arg);
 // ./scripts/default.js
 void httpd_content_scripts_default_js(void* resp_arg);
 // ./styles/default.css
@@ -28,11 +26,8 @@ void httpd_content_styles_default_css(void* resp_arg);
 
 #ifdef HTTPD_CONTENT_IMPLEMENTATION
 
-httpd_response_handler_t httpd_response_handlers[7] = {
+httpd_response_handler_t httpd_response_handlers[4] = {
     { "/", "/", httpd_content_index_clasp },
-    { "/api", "/api", httpd_content_api_index_clasp },
-    { "/api/", "/api/", httpd_content_api_index_clasp },
-    { "/api/index.clasp", "/api/index.clasp", httpd_content_api_index_clasp },
     { "/index.clasp", "/index.clasp", httpd_content_index_clasp },
     { "/scripts/default.js", "/scripts/default.js", httpd_content_scripts_default_js },
     { "/styles/default.css", "/styles/default.css", httpd_content_styles_default_css }
@@ -45,6 +40,8 @@ void httpd_content_index_clasp(void* resp_arg) {
         " Panel</title>\r\n    </head>\r\n    <body>\r\n        <script src=\"./scripts/default."
         "js\"></script>\r\n        <h1>Alarm Control Panel</h1>\r\n        <form method=\"get\" "
         "action=\"#\">\r\n", 476, resp_arg);
+    alarm_snapshot snap;
+    alarm_get_snapshot(&snap);
     for(size_t i = 0;i<alarm_count;++i) {
                 
     httpd_send_block("15\r\n\r\n            <label>\r\n", 27, resp_arg);
@@ -52,91 +49,80 @@ void httpd_content_index_clasp(void* resp_arg) {
     httpd_send_block("4A\r\n</label>\r\n            <label class=\"switch\">\r\n             "
         "   <input id=\"a\r\n", 80, resp_arg);
     httpd_send_expr(i, resp_arg);
-    httpd_send_block("43\r\n\" type=\"checkbox\" onclick=\"refreshSwitches(true);\" name=\"a\""
+    httpd_send_block("43\r\n\" type=\"checkbox\" onclick=\"refreshSwitches(this);\" name=\"a\""
         " value=\"\r\n", 73, resp_arg);
     httpd_send_expr(i, resp_arg);
     httpd_send_block("2\r\n\" \r\n", 7, resp_arg);
-    if(alarm_values[i]){
+    if(snap.value(i)){
     httpd_send_block("8\r\nchecked \r\n", 13, resp_arg);
     }
     httpd_send_block("5A\r\n/>\r\n                <span class=\"slider round\"></span>\r\n   "
         "         </label>\r\n            \r\n", 96, resp_arg);
     
     }
-    httpd_send_block("10A\r\n\r\n            <br />\r\n            <button class=\"button\" o"
+    httpd_send_block("105\r\n\r\n            <br />\r\n            <button class=\"button\" o"
         "nclick=\"resetAll();\" type=\"button\">Reset All</button>\r\n        </form>\r\n        "
-        "<script>\r\n            document.addEventListener(\"DOMContentLoaded\", refreshSwitc"
-        "hes);\r\n        </script>\r\n    </body>\r\n</html>\r\n\r\n0\r\n\r\n", 278, resp_arg);
-    free(resp_arg);
-}
-void httpd_content_api_index_clasp(void* resp_arg) {
-    httpd_send_block("HTTP/1.1 200 OK\r\nTransfer-Encoding: chunked\r\nContent-Type: appl"
-        "ication/json\r\n\r\nB\r\n{\"status\":[\r\n", 95, resp_arg);
-    
-    for(size_t i = 0;i<alarm_count;++i) {
-        bool b=alarm_values[i];
-        if(i==0) {
-            if(b) {
-                
-    httpd_send_block("4\r\ntrue\r\n", 9, resp_arg);
-    
-            } else {
-                
-    httpd_send_block("5\r\nfalse\r\n", 10, resp_arg);
-    
-            }
-        } else {
-            if(b) {
-                
-    httpd_send_block("5\r\n,true\r\n", 10, resp_arg);
-    
-            } else {
-                
-    httpd_send_block("6\r\n,false\r\n", 11, resp_arg);
-    
-            }
-        }
-    }
-    httpd_send_block("2\r\n]}\r\n0\r\n\r\n", 12, resp_arg);
-    free(resp_arg);
+        "<script>\r\n            document.addEventListener(\"DOMContentLoaded\", initialize);"
+        "\r\n        </script>\r\n    </body>\r\n</html>\r\n\r\n0\r\n\r\n", 273, resp_arg);
+    httpd_send_end(resp_arg);
 }
 void httpd_content_scripts_default_js(void* resp_arg) {
     // HTTP/1.1 200 OK
     // Content-Type: text/javascript
     // Content-Encoding: deflate
-    // Content-Length: 444
+    // Content-Length: 859
     // 
     static const unsigned char http_response_data[] = {
         0x48, 0x54, 0x54, 0x50, 0x2F, 0x31, 0x2E, 0x31, 0x20, 0x32, 0x30, 0x30, 0x20, 0x4F, 0x4B, 0x0D, 0x0A, 0x43, 0x6F, 0x6E, 
         0x74, 0x65, 0x6E, 0x74, 0x2D, 0x54, 0x79, 0x70, 0x65, 0x3A, 0x20, 0x74, 0x65, 0x78, 0x74, 0x2F, 0x6A, 0x61, 0x76, 0x61, 
         0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x0D, 0x0A, 0x43, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x2D, 0x45, 0x6E, 0x63, 0x6F, 
         0x64, 0x69, 0x6E, 0x67, 0x3A, 0x20, 0x64, 0x65, 0x66, 0x6C, 0x61, 0x74, 0x65, 0x0D, 0x0A, 0x43, 0x6F, 0x6E, 0x74, 0x65, 
-        0x6E, 0x74, 0x2D, 0x4C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x3A, 0x20, 0x34, 0x34, 0x34, 0x0D, 0x0A, 0x0D, 0x0A, 0xC4, 0x53, 
-        0x3D, 0x4F, 0xC3, 0x30, 0x10, 0xDD, 0x91, 0xF8, 0x0F, 0xC6, 0x03, 0x72, 0x54, 0x94, 0x76, 0x61, 0x21, 0x04, 0x44, 0xA5, 
-        0x0E, 0x65, 0x80, 0x01, 0x36, 0xC4, 0xE0, 0x3A, 0x97, 0xC6, 0xE0, 0x3A, 0x95, 0xED, 0x14, 0x21, 0xD4, 0xFF, 0xCE, 0xD9, 
-        0x21, 0x69, 0x53, 0x8A, 0x28, 0x1F, 0x02, 0x0F, 0x89, 0x75, 0x7E, 0x77, 0xEF, 0xEE, 0xDD, 0xDD, 0x82, 0x1B, 0xE2, 0xE4, 
-        0x0C, 0xCC, 0x38, 0x23, 0x29, 0xD1, 0x95, 0x52, 0xC9, 0xFE, 0x5E, 0x5E, 0x69, 0xE1, 0x64, 0xA9, 0x89, 0x01, 0x0B, 0xEE, 
-        0x42, 0x29, 0x16, 0x91, 0x97, 0xFD, 0x3D, 0x82, 0x47, 0xE6, 0xEC, 0x80, 0xB5, 0x0E, 0xB5, 0x47, 0xD4, 0xBE, 0xFA, 0x23, 
-        0x14, 0x70, 0x33, 0xD6, 0x0E, 0xCC, 0x82, 0xAB, 0x06, 0x1A, 0x25, 0x35, 0x60, 0x59, 0xFF, 0xEA, 0x6F, 0x0E, 0x4E, 0x14, 
-        0x8C, 0xC6, 0x7D, 0x3E, 0x97, 0xE7, 0x48, 0x44, 0xA3, 0xDA, 0x1E, 0xBB, 0x02, 0x34, 0x43, 0xEE, 0x79, 0xA9, 0x2D, 0x90, 
-        0xF4, 0x8C, 0x34, 0xF7, 0xF8, 0xC1, 0x96, 0x9A, 0x45, 0x1D, 0x1C, 0x57, 0xDC, 0xCC, 0xAC, 0x47, 0xAD, 0x25, 0x91, 0x97, 
-        0x86, 0x2D, 0xB0, 0x34, 0x89, 0x45, 0x0D, 0x12, 0x79, 0x5A, 0x83, 0x62, 0xEB, 0xB8, 0xAB, 0x6C, 0xAC, 0x40, 0x4F, 0x5D, 
-        0x91, 0xF4, 0x7A, 0xB2, 0x93, 0x79, 0xC8, 0x1E, 0x69, 0x1C, 0x91, 0x5E, 0x0C, 0xCA, 0x69, 0x4F, 0x26, 0xDB, 0x9E, 0xC5, 
-        0x04, 0x9F, 0xB3, 0x52, 0x54, 0x33, 0xD0, 0x2E, 0x9E, 0x82, 0x1B, 0x29, 0xF0, 0xD7, 0xE1, 0xF3, 0x38, 0x63, 0xB2, 0x2D, 
-        0xB6, 0x75, 0x9A, 0xC4, 0xA2, 0x00, 0xF1, 0x08, 0x3E, 0x6A, 0x27, 0x93, 0x3B, 0x79, 0xBF, 0x86, 0x7D, 0x13, 0x67, 0xD9, 
-        0x94, 0x27, 0xB8, 0xD7, 0x07, 0x8C, 0x29, 0x8D, 0x2F, 0xCF, 0x73, 0x97, 0x0A, 0xE2, 0x60, 0x60, 0x74, 0x14, 0xEC, 0x41, 
-        0x43, 0xA9, 0xA7, 0xE4, 0xF2, 0xE6, 0xFA, 0x8A, 0x64, 0xDC, 0xF1, 0x13, 0x7A, 0x44, 0x02, 0x24, 0x6A, 0xF2, 0x58, 0xF5, 
-        0x17, 0x45, 0x6E, 0x3B, 0x63, 0x20, 0x47, 0x59, 0x8B, 0x9B, 0x27, 0x89, 0x11, 0xC0, 0x1E, 0x1D, 0x0F, 0x06, 0xDE, 0x61, 
-        0xD9, 0x69, 0x7F, 0x07, 0xC2, 0x9E, 0x8C, 0x74, 0xD0, 0x4A, 0xE6, 0xF5, 0xAD, 0x8C, 0xF2, 0x4A, 0x85, 0x16, 0xF6, 0x69, 
-        0xF2, 0x9B, 0x33, 0x82, 0x51, 0x02, 0x5F, 0x9A, 0x3A, 0x53, 0x41, 0xC7, 0x1D, 0x59, 0x7B, 0x29, 0x0D, 0x23, 0xB3, 0x32, 
-        0xFA, 0x74, 0xC4, 0xC4, 0x6E, 0xEF, 0x8C, 0x1D, 0x3E, 0xDF, 0xF2, 0xE9, 0x15, 0x9F, 0x01, 0xA3, 0x52, 0xCF, 0x2B, 0x9C, 
-        0xB5, 0xE4, 0xE3, 0x69, 0xC1, 0x30, 0x7F, 0x3D, 0x23, 0x58, 0xAD, 0x98, 0x1C, 0xA4, 0x95, 0xCE, 0x20, 0x97, 0x1A, 0xB2, 
-        0x77, 0xA4, 0x2D, 0xA8, 0x99, 0xA5, 0xAD, 0x88, 0x56, 0x1D, 0x46, 0x0F, 0x79, 0x8A, 0xB9, 0x6D, 0xF2, 0x04, 0x81, 0x49, 
-        0xD7, 0xB6, 0x7C, 0x3F, 0x82, 0xEB, 0x0B, 0x8A, 0xF1, 0xA2, 0x15, 0x62, 0xD7, 0xE5, 0xFC, 0x64, 0x41, 0x7F, 0xB4, 0xA4, 
-        0x3B, 0x34, 0xE1, 0xDB, 0x8D, 0xF8, 0xCA, 0xC2, 0x6E, 0x8A, 0xB7, 0x5E, 0xFA, 0x7F, 0x2D, 0xEF, 0x2B, 0x00, 0x00, 0x00, 
-        0xFF, 0xFF };
+        0x6E, 0x74, 0x2D, 0x4C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x3A, 0x20, 0x38, 0x35, 0x39, 0x0D, 0x0A, 0x0D, 0x0A, 0xBC, 0x56, 
+        0x51, 0x6F, 0xD3, 0x30, 0x10, 0x7E, 0x9F, 0xB4, 0xFF, 0x70, 0xE4, 0x01, 0x12, 0x5A, 0x65, 0xD5, 0x24, 0x78, 0xA0, 0x74, 
+        0x13, 0x48, 0x7B, 0x18, 0x62, 0x80, 0x18, 0x3C, 0x21, 0x1E, 0xDC, 0xE4, 0xD2, 0x18, 0x5C, 0x3B, 0xB2, 0x9D, 0x45, 0x05, 
+        0xED, 0xBF, 0x73, 0x76, 0x92, 0xC6, 0x49, 0x3B, 0x09, 0x1E, 0x46, 0x5E, 0xD2, 0xDE, 0xF9, 0x7C, 0xDF, 0x9D, 0xBF, 0xEF, 
+        0x9C, 0x3B, 0xA6, 0xC1, 0xF2, 0x2D, 0xEA, 0xEB, 0x1C, 0x56, 0x20, 0x6B, 0x21, 0x96, 0xA7, 0x27, 0x77, 0x64, 0xC4, 0x3B, 
+        0x94, 0xD6, 0x0C, 0xB6, 0xB3, 0x33, 0x28, 0x55, 0x03, 0x42, 0xC9, 0x0D, 0x58, 0x05, 0x95, 0x12, 0x02, 0xD6, 0x58, 0x28, 
+        0x8D, 0x60, 0xF5, 0x8E, 0x3B, 0x6B, 0x89, 0x6D, 0x14, 0x18, 0xAB, 0x91, 0x6D, 0x81, 0x6D, 0x18, 0x97, 0x29, 0x70, 0x0B, 
+        0xB9, 0xAA, 0xD7, 0x02, 0x0D, 0x20, 0xCB, 0x4A, 0xBF, 0x95, 0x4B, 0xE9, 0x03, 0x2A, 0x26, 0x51, 0x80, 0xAD, 0xB5, 0x34, 
+        0x50, 0x1B, 0x60, 0x0D, 0xDB, 0xCD, 0xC1, 0x28, 0x60, 0xB0, 0xAE, 0xCD, 0xAE, 0x73, 0x73, 0x23, 0x9F, 0x59, 0x28, 0xD9, 
+        0x96, 0x70, 0x62, 0xDE, 0xE2, 0xD3, 0x48, 0x69, 0x6F, 0x1C, 0xC0, 0xF3, 0xC5, 0x62, 0xB1, 0x0C, 0x8C, 0x61, 0x25, 0x45, 
+        0x2D, 0x33, 0xCB, 0x95, 0x04, 0x56, 0x55, 0x62, 0x77, 0xDB, 0x70, 0x9B, 0x95, 0x68, 0x62, 0x26, 0x98, 0xDE, 0x9A, 0x04, 
+        0x7E, 0x9F, 0x9E, 0x00, 0x3D, 0x54, 0x45, 0xEC, 0xC2, 0x39, 0x05, 0x2E, 0x96, 0xFC, 0x75, 0xEB, 0x4E, 0x8D, 0x65, 0xB6, 
+        0x36, 0xA9, 0x40, 0xB9, 0xB1, 0xE5, 0x72, 0x36, 0xE3, 0xFB, 0x00, 0xF7, 0x64, 0x4A, 0x1A, 0x0B, 0xDC, 0x25, 0x8B, 0x58, 
+        0x34, 0xE3, 0xCB, 0xA9, 0x2B, 0x5B, 0x93, 0x2B, 0x57, 0x59, 0xBD, 0xA5, 0x9E, 0xA4, 0x1B, 0xB4, 0x57, 0x02, 0xDD, 0xCF, 
+        0xB7, 0x84, 0x30, 0xE6, 0x79, 0x12, 0x06, 0xAC, 0x53, 0xC2, 0x95, 0xFD, 0x44, 0xB7, 0xDB, 0x28, 0xFB, 0x37, 0xFE, 0xBD, 
+        0x5B, 0x77, 0x7F, 0x7A, 0x72, 0x1F, 0x14, 0x44, 0x6E, 0x6D, 0x3F, 0xD1, 0x29, 0x50, 0xEB, 0xE3, 0x3D, 0x30, 0x5E, 0xC4, 
+        0xFD, 0xC1, 0xB5, 0x3D, 0x18, 0x41, 0x1E, 0x0E, 0xDA, 0xA0, 0xBD, 0x96, 0x16, 0xF5, 0x1D, 0x13, 0xB1, 0xC6, 0x42, 0xA3, 
+        0x29, 0xFB, 0xE6, 0xCC, 0x5F, 0x2C, 0x16, 0xC9, 0x43, 0x39, 0x55, 0x75, 0x2C, 0xE5, 0x93, 0x78, 0xBF, 0x73, 0x97, 0x75, 
+        0xDC, 0x29, 0x81, 0x4C, 0xEF, 0xD3, 0x75, 0x4B, 0xC3, 0xF2, 0x0F, 0x08, 0x78, 0x24, 0xB7, 0x3F, 0xDA, 0x2B, 0x5F, 0xDB, 
+        0x28, 0xF7, 0xFE, 0xC8, 0x8F, 0xD4, 0x3B, 0xD0, 0x81, 0xEA, 0xFD, 0x42, 0x49, 0x54, 0x6D, 0x63, 0x8A, 0x5E, 0x5D, 0x84, 
+        0xAB, 0xC6, 0x2B, 0x03, 0x04, 0xFD, 0xE3, 0x5B, 0xDD, 0xA7, 0x0E, 0x7C, 0xF7, 0xF3, 0x8E, 0x84, 0xA1, 0x71, 0xE0, 0xE5, 
+        0x0D, 0xB3, 0x65, 0xBA, 0xE5, 0x32, 0xEE, 0x4C, 0xCF, 0xCF, 0xE7, 0x2F, 0x89, 0xAA, 0x0F, 0x37, 0x37, 0xC8, 0x12, 0x36, 
+        0xB7, 0xE1, 0x32, 0x57, 0x4D, 0xEA, 0x5D, 0xB7, 0xAA, 0xD6, 0x19, 0x4E, 0x8B, 0x24, 0xF5, 0x40, 0xC1, 0x84, 0xC1, 0x61, 
+        0x67, 0xF7, 0x1A, 0x24, 0x8C, 0x0D, 0x04, 0xE1, 0x71, 0x94, 0x9E, 0xB1, 0x8A, 0x9F, 0xB5, 0xFE, 0xA8, 0xC7, 0xD3, 0xFE, 
+        0x4D, 0x95, 0x54, 0x15, 0x4A, 0x8A, 0x3A, 0x68, 0x14, 0xE9, 0xB6, 0xC1, 0x67, 0x24, 0xF8, 0x35, 0x3A, 0xBD, 0x57, 0xB5, 
+        0x29, 0x89, 0xB0, 0x34, 0x0C, 0xBC, 0xD0, 0xBD, 0x6C, 0x1D, 0x43, 0x80, 0x99, 0x9F, 0xE4, 0x3F, 0xD6, 0x92, 0x4E, 0xAA, 
+        0x43, 0x63, 0x03, 0x3E, 0xF5, 0xD8, 0xA7, 0x68, 0xB6, 0x68, 0x0C, 0xDB, 0xA0, 0x03, 0x84, 0x1E, 0xD1, 0x58, 0xCA, 0xEF, 
+        0x6E, 0x3F, 0x7E, 0x48, 0x2B, 0xA6, 0x0D, 0xC6, 0x98, 0xE6, 0xCC, 0xB2, 0xE4, 0xA0, 0x1E, 0xD4, 0x5A, 0xE9, 0x07, 0x0A, 
+        0x1A, 0x66, 0x50, 0xE3, 0x26, 0x97, 0x9B, 0x3F, 0xA0, 0xDC, 0x20, 0x29, 0x6A, 0x43, 0xC5, 0x91, 0xFC, 0xDB, 0x51, 0x47, 
+        0x23, 0x82, 0x66, 0x52, 0x53, 0x72, 0x81, 0x73, 0x17, 0x24, 0xDD, 0xD4, 0x3B, 0xD8, 0x29, 0x1C, 0x7C, 0x83, 0xB3, 0x03, 
+        0x92, 0x09, 0x45, 0x20, 0x43, 0xAE, 0x4C, 0x67, 0x6C, 0x6F, 0xA7, 0x53, 0x9F, 0x0A, 0x6A, 0x4A, 0xD8, 0xB1, 0xFC, 0x43, 
+        0x52, 0x4E, 0xFA, 0x3E, 0xE1, 0x6D, 0xDF, 0xDE, 0x8E, 0x35, 0x56, 0xD7, 0x8E, 0x34, 0x21, 0x0F, 0xB9, 0xE4, 0x96, 0x33, 
+        0xC1, 0x7F, 0xE1, 0x98, 0x86, 0x23, 0x7E, 0x4E, 0x18, 0x38, 0x1A, 0x20, 0x71, 0xF2, 0x90, 0x82, 0x49, 0x85, 0x6F, 0x84, 
+        0xF8, 0x2F, 0xA3, 0xA3, 0x1B, 0xEC, 0x48, 0x88, 0x3A, 0xBA, 0x5F, 0x52, 0xF6, 0x28, 0x69, 0xED, 0xA9, 0x3B, 0x41, 0xD2, 
+        0xA5, 0xA9, 0x68, 0x52, 0xA3, 0x63, 0x45, 0xFF, 0x3B, 0xFD, 0x61, 0x94, 0xA4, 0xFA, 0xC2, 0x75, 0xED, 0x40, 0x3E, 0xA4, 
+        0x5E, 0x77, 0x8B, 0xF4, 0x6B, 0x33, 0xE6, 0x92, 0x75, 0x64, 0xBB, 0xF0, 0x97, 0x80, 0x12, 0x98, 0x7A, 0x43, 0x1C, 0x5D, 
+        0x79, 0xBB, 0x07, 0xE4, 0xC4, 0xE3, 0x68, 0x0B, 0x8E, 0xAE, 0xAF, 0xA2, 0x39, 0xF8, 0x25, 0x7B, 0xDE, 0x1E, 0x1C, 0xED, 
+        0xB8, 0x89, 0xE3, 0x5E, 0x37, 0x9A, 0xDB, 0x61, 0x1E, 0xB8, 0x4B, 0xAC, 0xD6, 0xC2, 0x5D, 0x49, 0xAD, 0xC4, 0xA3, 0xE5, 
+        0xA3, 0x77, 0xBA, 0xDB, 0xDE, 0x03, 0x79, 0xB2, 0xAA, 0x65, 0x8E, 0x05, 0x97, 0x24, 0x9D, 0xA7, 0x4F, 0xC1, 0xDB, 0x52, 
+        0xDA, 0xAF, 0x0E, 0x3D, 0xC9, 0x44, 0x82, 0x4A, 0x8A, 0x1D, 0x0D, 0x68, 0x99, 0x7B, 0x09, 0x91, 0x5C, 0xE9, 0xCD, 0xE8, 
+        0xFA, 0x2C, 0x99, 0xDC, 0x60, 0x9E, 0x7A, 0x6B, 0x53, 0x52, 0x2B, 0xDD, 0x14, 0xA7, 0x0B, 0x15, 0xFD, 0xD7, 0x40, 0x41, 
+        0x9F, 0x15, 0x9C, 0xEE, 0x75, 0xF8, 0xFA, 0xF9, 0xFD, 0xB0, 0x1D, 0x15, 0x3F, 0x5B, 0xB5, 0x58, 0xFA, 0x1B, 0xF5, 0x32, 
+        0xBA, 0x54, 0x72, 0x15, 0xBD, 0xA2, 0x57, 0x51, 0xAC, 0xA2, 0x64, 0x16, 0xA0, 0x1A, 0x57, 0xD1, 0xB2, 0x85, 0xB6, 0x48, 
+        0x86, 0x0D, 0xFF, 0x96, 0x29, 0xFF, 0xCA, 0x96, 0x47, 0x67, 0xCC, 0x1F, 0x00, 0x00, 0x00, 0xFF, 0xFF };
     httpd_send_block((const char*)http_response_data,sizeof(http_response_data), resp_arg);
-    free(resp_arg);
+    httpd_send_end(resp_arg);
 }
 void httpd_content_styles_default_css(void* resp_arg) {
     // HTTP/1.1 200 OK
@@ -176,6 +162,6 @@ void httpd_content_styles_default_css(void* resp_arg) {
         0xE2, 0x46, 0xB9, 0x5F, 0xBA, 0xE8, 0x12, 0x37, 0x39, 0x81, 0xE1, 0xBF, 0xD1, 0x01, 0x1C, 0x06, 0xE3, 0x42, 0x74, 0xCA, 
         0x65, 0x33, 0x08, 0x70, 0x18, 0x37, 0xF0, 0x1F, 0x00, 0x00, 0x00, 0xFF, 0xFF };
     httpd_send_block((const char*)http_response_data,sizeof(http_response_data), resp_arg);
-    free(resp_arg);
+    httpd_send_end(resp_arg);
 }
 #endif // HTTPD_CONTENT_IMPLEMENTATION
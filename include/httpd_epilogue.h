@@ -1 +1 @@
-﻿free(resp_arg);
\ No newline at end of file
+﻿httpd_send_end(resp_arg);
\ No newline at end of file
@@ -0,0 +1,57 @@
+#ifndef PORT_SCAN_H
+#define PORT_SCAN_H
+#include <stdint.h>
+#include <stddef.h>
+
+// Samples many inputs by reading each port register they live on once per
+// scan, instead of looking each pin up and reading its port on every read.
+// Which port and bit each input is on is worked out once, up front.
+
+template <typename Word, size_t Count>
+struct port_scan {
+    // each distinct port register the inputs live on
+    volatile Word* ports[Count];
+    size_t ports_count;
+    // for each input, the index of its port in ports, and its bit there
+    uint8_t input_ports[Count];
+    Word input_masks[Count];
+};
+template <typename Word, size_t Count>
+static inline void port_scan_init(port_scan<Word, Count>* scan) {
+    scan->ports_count = 0;
+}
+// puts input <input> on the <mask> bit of the register at <port>
+template <typename Word, size_t Count>
+static inline void port_scan_add(port_scan<Word, Count>* scan, size_t input,
+                                 volatile Word* port, Word mask) {
+    size_t i = 0;
+    while (i < scan->ports_count && scan->ports[i] != port) {
+        ++i;
+    }
+    if (i == scan->ports_count) {
+        scan->ports[scan->ports_count++] = port;
+    }
+    scan->input_ports[input] = (uint8_t)i;
+    scan->input_masks[input] = mask;
+}
+// samples every input into <out_values>, one bit per input, packed into
+// words the width of a port register
+template <typename Word, size_t Count>
+static inline void port_scan_read(const port_scan<Word, Count>* scan,
+                                  Word* out_values) {
+    static constexpr const size_t word_bits = sizeof(Word) * 8;
+    Word ports[Count];
+    for (size_t i = 0; i < scan->ports_count; ++i) {
+        ports[i] = *scan->ports[i];
+    }
+    for (size_t i = 0; i < (Count + word_bits - 1) / word_bits; ++i) {
+        out_values[i] = 0;
+    }
+    for (size_t i = 0; i < Count; ++i) {
+        if (ports[scan->input_ports[i]] & scan->input_masks[i]) {
+            out_values[i / word_bits] |= (Word)((Word)1 << (i % word_bits));
+        }
+    }
+}
+
+#endif
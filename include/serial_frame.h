@@ -0,0 +1,133 @@
+#ifndef SERIAL_FRAME_H
+#define SERIAL_FRAME_H
+#include <stdint.h>
+#include <stddef.h>
+
+// Commands travel between the control and the slave as frames. Each frame is
+// the command bytes followed by a CRC-8 of them, COBS encoded so the frame
+// contains no zeroes, and then terminated with a zero. A dropped or corrupt
+// byte costs at most the frame it landed in (and the next, if it was the
+// zero) - the receiver picks back up at the following zero.
+
+// the largest command payload, not counting the CRC
+static constexpr const size_t serial_frame_max_payload = 64;
+// the largest encoded frame, including the trailing zero
+static constexpr const size_t serial_frame_max_size =
+    serial_frame_max_payload + 1 + 1 + ((serial_frame_max_payload + 1) / 254) +
+    1;
+
+// CRC-8, polynomial 0x07. it starts from 0xFF rather than zero so that two
+// good frames run together by a lost delimiter don't check out as one
+static inline uint8_t serial_frame_crc8(const uint8_t* data, size_t size,
+                                        uint8_t crc = 0xFF) {
+    while (size--) {
+        crc ^= *data++;
+        for (int i = 0; i < 8; ++i) {
+            crc = (crc & 0x80) ? (uint8_t)((crc << 1) ^ 0x07)
+                               : (uint8_t)(crc << 1);
+        }
+    }
+    return crc;
+}
+
+// encodes <payload> into <out_frame>, which must hold serial_frame_max_size
+// bytes. returns the number of bytes to send, or 0 if the payload is empty
+// (every frame carries at least a command) or too big
+static inline size_t serial_frame_encode(const uint8_t* payload, size_t size,
+                                         uint8_t* out_frame) {
+    if (size == 0 || size > serial_frame_max_payload) {
+        return 0;
+    }
+    const uint8_t crc = serial_frame_crc8(payload, size);
+    size_t code_index = 0;
+    size_t out_index = 1;
+    uint8_t code = 1;
+    for (size_t i = 0; i <= size; ++i) {
+        const uint8_t value = (i < size) ? payload[i] : crc;
+        if (value == 0) {
+            out_frame[code_index] = code;
+            code_index = out_index++;
+            code = 1;
+        } else {
+            out_frame[out_index++] = value;
+            if (++code == 0xFF) {
+                out_frame[code_index] = code;
+                code_index = out_index++;
+                code = 1;
+            }
+        }
+    }
+    out_frame[code_index] = code;
+    out_frame[out_index++] = 0;
+    return out_index;
+}
+
+struct serial_frame_decoder {
+    uint8_t buffer[serial_frame_max_size];
+    size_t size;
+    bool overflow;
+    // frames dropped due to bad CRCs, bad encoding or overflow
+    unsigned long errors;
+};
+static inline void serial_frame_decoder_init(serial_frame_decoder* decoder) {
+    decoder->size = 0;
+    decoder->overflow = false;
+    decoder->errors = 0;
+}
+// feeds one received byte to the decoder. when it completes a good frame,
+// returns true, and points <out_payload> at the command bytes, which stay
+// valid until the next call
+static inline bool serial_frame_decode(serial_frame_decoder* decoder,
+                                       uint8_t value,
+                                       const uint8_t** out_payload,
+                                       size_t* out_size) {
+    if (value != 0) {
+        if (decoder->size < sizeof(decoder->buffer)) {
+            decoder->buffer[decoder->size++] = value;
+        } else {
+            decoder->overflow = true;
+        }
+        return false;
+    }
+    // end of frame
+    const size_t size = decoder->size;
+    const bool overflow = decoder->overflow;
+    decoder->size = 0;
+    decoder->overflow = false;
+    if (size == 0) {
+        // back to back delimiters
+        return false;
+    }
+    if (overflow) {
+        ++decoder->errors;
+        return false;
+    }
+    // decode in place. the output never overtakes the input
+    uint8_t* buffer = decoder->buffer;
+    size_t in_index = 0;
+    size_t out_index = 0;
+    while (in_index < size) {
+        const uint8_t code = buffer[in_index++];
+        for (uint8_t i = 1; i < code; ++i) {
+            if (in_index >= size) {
+                ++decoder->errors;
+                return false;
+            }
+            buffer[out_index++] = buffer[in_index++];
+        }
+        if (code < 0xFF && in_index < size) {
+            buffer[out_index++] = 0;
+        }
+    }
+    // need at least a command and a CRC, and the CRC of the whole thing,
+    // CRC included, comes out to zero when it's intact
+    if (out_index < 2 || serial_frame_crc8(buffer, out_index) != 0) {
+        ++decoder->errors;
+        return false;
+    }
+    *out_payload = buffer;
+    *out_size = out_index - 1;
+    return true;
+}
+
+#endif
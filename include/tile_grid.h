@@ -0,0 +1,73 @@
+#ifndef TILE_GRID_H
+#define TILE_GRID_H
+#include <stdint.h>
+#include <stddef.h>
+
+// Lays equal square tiles out in rows across an area, as big as will still
+// fit all of them, and maps between tiles and points. Coordinates are
+// relative to the top left of the area.
+
+struct tile_grid {
+    uint16_t tile_size;
+    uint16_t tile_gap;
+    uint16_t columns;
+};
+// finds the largest tiles that fit <count> of them in <width> by <height>.
+// tiles bigger than 3 pixels get a pixel between them
+static inline void tile_grid_layout(tile_grid* grid, int width, int height,
+                                    size_t count) {
+    grid->tile_size = 1;
+    grid->tile_gap = 0;
+    grid->columns = width > 0 ? width : 1;
+    for (int s = width < height ? width : height; s > 1; --s) {
+        const int gap = s > 3 ? 1 : 0;
+        const int columns = (width + gap) / (s + gap);
+        const int rows = (height + gap) / (s + gap);
+        if ((size_t)(columns * rows) >= count) {
+            grid->tile_size = s;
+            grid->tile_gap = gap;
+            grid->columns = columns;
+            return;
+        }
+    }
+}
+// the top left corner of tile <index>
+static inline void tile_grid_origin(const tile_grid* grid, size_t index,
+                                    int* out_x, int* out_y) {
+    const int pitch = grid->tile_size + grid->tile_gap;
+    *out_x = (int)(index % grid->columns) * pitch;
+    *out_y = (int)(index / grid->columns) * pitch;
+}
+// finds the tile of the <count> under <x>,<y>. a point in the gap after a
+// tile counts as that tile. returns false if there isn't one
+static inline bool tile_grid_hit(const tile_grid* grid, size_t count, int x,
+                                 int y, size_t* out_index) {
+    if (x < 0 || y < 0) {
+        return false;
+    }
+    const int pitch = grid->tile_size + grid->tile_gap;
+    const size_t column = x / pitch;
+    const size_t index = (y / pitch) * grid->columns + column;
+    if (column >= grid->columns || index >= count) {
+        return false;
+    }
+    *out_index = index;
+    return true;
+}
+// the first and last rows and columns that the rectangle <x1>,<y1> to
+// <x2>,<y2> touches, so painting a clip only visits the tiles under it
+static inline void tile_grid_span(const tile_grid* grid, int x1, int y1,
+                                  int x2, int y2, size_t* out_column1,
+                                  size_t* out_row1, size_t* out_column2,
+                                  size_t* out_row2) {
+    const int pitch = grid->tile_size + grid->tile_gap;
+    *out_column1 = x1 < 0 ? 0 : x1 / pitch;
+    *out_row1 = y1 < 0 ? 0 : y1 / pitch;
+    *out_column2 = x2 < 0 ? 0 : x2 / pitch;
+    if (*out_column2 >= grid->columns) {
+        *out_column2 = grid->columns - 1;
+    }
+    *out_row2 = y2 < 0 ? 0 : y2 / pitch;
+}
+
+#endif
@@ -0,0 +1,481 @@
+#ifndef UI_CONTROLS_H
+#define UI_CONTROLS_H
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <gfx.hpp>
+#include <uix.hpp>
+#ifdef ESP_PLATFORM
+#include "esp_heap_caps.h"
+#include "esp_timer.h"
+#endif
+#include "tile_grid.h"
+
+// The panel's own UIX controls: the paging arrows, the captioned buttons
+// and the alarm overview. They draw the same on the host, where
+// test_ui_render times them.
+
+template <typename ControlSurfaceType>
+class arrow_box : public uix::control<ControlSurfaceType> {
+    using base_type = uix::control<ControlSurfaceType>;
+    // the arrow is rasterized once per state and blitted from then on
+    using image_type = gfx::bitmap<gfx::rgba_pixel<32>>;
+
+   public:
+    typedef void (*on_pressed_changed_callback_type)(bool pressed, void* state);
+
+   private:
+    bool m_pressed;
+    bool m_dirty;
+    gfx::sizef m_svg_size;
+    // the fit for the normal and pressed states
+    gfx::matrix m_fit[2];
+    // the normal and pressed images, or null if they couldn't be allocated
+    void* m_images[2];
+    gfx::size16 m_images_size;
+    on_pressed_changed_callback_type m_on_pressed_changed_callback;
+    void* m_on_pressed_changed_callback_state;
+    gfx::stream* m_svg;
+    static gfx::rectf correct_aspect(gfx::srect16& sr, float aspect) {
+        if (sr.width() > sr.height()) {
+            sr.y2 /= aspect;
+        } else {
+            sr.x2 *= aspect;
+        }
+        return (gfx::rectf)sr;
+    }
+    void free_images() {
+        for (size_t i = 0; i < 2; ++i) {
+            if (m_images[i] != nullptr) {
+                free(m_images[i]);
+                m_images[i] = nullptr;
+            }
+        }
+    }
+    void rasterize() {
+        const gfx::size16 size = (gfx::size16)this->dimensions();
+        if (size.width != m_images_size.width ||
+            size.height != m_images_size.height) {
+            free_images();
+            m_images_size = size;
+        }
+        const size_t len = image_type::sizeof_buffer(size);
+        for (size_t i = 0; i < 2; ++i) {
+            if (m_images[i] == nullptr) {
+#ifdef ESP_PLATFORM
+                // PSRAM if we have it, otherwise the regular heap
+                m_images[i] = heap_caps_malloc(len, MALLOC_CAP_SPIRAM);
+                if (m_images[i] == nullptr) {
+                    m_images[i] = heap_caps_malloc(len, MALLOC_CAP_8BIT);
+                }
+#else
+                m_images[i] = malloc(len);
+#endif
+                if (m_images[i] == nullptr) {
+                    // we'll render straight to the screen instead
+                    puts("Unable to allocate arrow images");
+                    free_images();
+                    return;
+                }
+            }
+            // all zeroes is fully transparent
+            memset(m_images[i], 0, len);
+            image_type img(size, m_images[i]);
+            gfx::canvas cvs(size);
+            cvs.initialize();
+            gfx::draw::canvas(img, cvs);
+            m_svg->seek(0);
+            if (gfx::gfx_result::success != cvs.render_svg(*m_svg, m_fit[i])) {
+                puts("SVG render error");
+            }
+        }
+    }
+
+   public:
+    arrow_box()
+        : base_type(),
+          m_pressed(false),
+          m_dirty(true),
+          m_images{nullptr, nullptr},
+          m_on_pressed_changed_callback(nullptr),
+          m_svg(nullptr) {}
+    virtual ~arrow_box() { free_images(); }
+    void svg(gfx::stream& svg_stream) {
+        m_svg = &svg_stream;
+        m_dirty = true;
+        this->invalidate();
+    }
+    gfx::stream& svg() const { return *m_svg; }
+    bool pressed() const { return m_pressed; }
+    void on_pressed_changed_callback(on_pressed_changed_callback_type callback,
+                                     void* state = nullptr) {
+        m_on_pressed_changed_callback = callback;
+        m_on_pressed_changed_callback_state = state;
+    }
+
+   protected:
+    virtual void on_before_paint() override {
+        const gfx::size16 size = (gfx::size16)this->dimensions();
+        if (size.width != m_images_size.width ||
+            size.height != m_images_size.height) {
+            // we were resized
+            m_dirty = true;
+        }
+        if (m_dirty) {
+            m_svg_size = {0.f, 0.f};
+            if (m_svg != nullptr) {
+                m_svg->seek(0);
+                gfx::canvas::svg_dimensions(*m_svg, &m_svg_size);
+                gfx::ssize16 dim = this->dimensions();
+                const float xo = dim.width / 8;
+                const float yo = dim.height / 8;
+                for (size_t i = 0; i < 2; ++i) {
+                    gfx::srect16 sr = this->dimensions().bounds();
+                    gfx::rectf corrected =
+                        correct_aspect(sr, m_svg_size.aspect_ratio())
+                            .inflate(-xo, -yo);
+                    m_fit[i] = gfx::matrix::create_fit_to(
+                        m_svg_size,
+                        corrected.offset(
+                            (dim.width - corrected.width()) * .5f + (xo * i),
+                            (dim.height - corrected.height()) * .5f +
+                                (yo * i)));
+                }
+                rasterize();
+            }
+            m_dirty = false;
+        }
+    }
+    virtual void on_paint(ControlSurfaceType& dst,
+                          const gfx::srect16& clip) override {
+        if (m_dirty || m_svg == nullptr) {
+            puts("Paint not ready");
+            return;
+        }
+#ifdef ARROW_PAINT_TIMING
+        const int64_t start = esp_timer_get_time();
+#endif
+        void* image = m_images[m_pressed];
+        if (image != nullptr) {
+            image_type img(m_images_size, image);
+            gfx::draw::bitmap(dst, (gfx::srect16)img.bounds(), img,
+                              img.bounds());
+        } else {
+            gfx::canvas cvs((gfx::size16)this->dimensions());
+            cvs.initialize();
+            gfx::draw::canvas(dst, cvs);
+            m_svg->seek(0);
+            if (gfx::gfx_result::success !=
+                cvs.render_svg(*m_svg, m_fit[m_pressed])) {
+                puts("SVG render error");
+            }
+        }
+#ifdef ARROW_PAINT_TIMING
+        printf("Arrow paint: %dus (%s)\n",
+               (int)(esp_timer_get_time() - start),
+               image != nullptr ? "cached" : "rendered");
+#endif
+    }
+    virtual bool on_touch(size_t locations_size,
+                          const gfx::spoint16* locations) override {
+        if (!m_pressed) {
+            m_pressed = true;
+            if (m_on_pressed_changed_callback != nullptr) {
+                m_on_pressed_changed_callback(
+                    true, m_on_pressed_changed_callback_state);
+            }
+            // both states are already rasterized. just repaint
+            this->invalidate();
+        }
+        return true;
+    }
+    virtual void on_release() override {
+        if (m_pressed) {
+            m_pressed = false;
+            if (m_on_pressed_changed_callback != nullptr) {
+                m_on_pressed_changed_callback(
+                    false, m_on_pressed_changed_callback_state);
+            }
+            this->invalidate();
+        }
+    }
+};
+
+// a push button with its caption drawn from a prerendered VLW font. the
+// colors swap while it's pressed
+template <typename ControlSurfaceType>
+class text_button : public uix::control<ControlSurfaceType> {
+    using base_type = uix::control<ControlSurfaceType>;
+    using color32_type = gfx::color<gfx::rgba_pixel<32>>;
+
+   public:
+    typedef void (*on_pressed_changed_callback_type)(bool pressed, void* state);
+
+   private:
+    bool m_pressed;
+    const char* m_text;
+    const gfx::font* m_font;
+    gfx::rgba_pixel<32> m_color;
+    gfx::rgba_pixel<32> m_back_color;
+    gfx::rgba_pixel<32> m_border_color;
+    gfx::sizef m_radiuses;
+    on_pressed_changed_callback_type m_on_pressed_changed_callback;
+    void* m_on_pressed_changed_callback_state;
+
+   public:
+    text_button()
+        : base_type(),
+          m_pressed(false),
+          m_text(nullptr),
+          m_font(nullptr),
+          m_color(color32_type::black),
+          m_back_color(color32_type::white),
+          m_border_color(color32_type::gray),
+          m_radiuses({0, 0}),
+          m_on_pressed_changed_callback(nullptr) {}
+    const char* text() const { return m_text; }
+    void text(const char* value) {
+        m_text = value;
+        this->invalidate();
+    }
+    const gfx::font& text_font() const { return *m_font; }
+    void text_font(const gfx::font& value) {
+        m_font = &value;
+        this->invalidate();
+    }
+    gfx::rgba_pixel<32> color() const { return m_color; }
+    void color(gfx::rgba_pixel<32> value) {
+        m_color = value;
+        this->invalidate();
+    }
+    gfx::rgba_pixel<32> back_color() const { return m_back_color; }
+    void back_color(gfx::rgba_pixel<32> value) {
+        m_back_color = value;
+        this->invalidate();
+    }
+    gfx::rgba_pixel<32> border_color() const { return m_border_color; }
+    void border_color(gfx::rgba_pixel<32> value) {
+        m_border_color = value;
+        this->invalidate();
+    }
+    gfx::sizef radiuses() const { return m_radiuses; }
+    void radiuses(gfx::sizef value) {
+        m_radiuses = value;
+        this->invalidate();
+    }
+    bool pressed() const { return m_pressed; }
+    void on_pressed_changed_callback(on_pressed_changed_callback_type callback,
+                                     void* state = nullptr) {
+        m_on_pressed_changed_callback = callback;
+        m_on_pressed_changed_callback_state = state;
+    }
+
+   protected:
+    virtual void on_paint(ControlSurfaceType& dst,
+                          const gfx::srect16& clip) override {
+#ifdef BUTTON_PAINT_TIMING
+        const int64_t start = esp_timer_get_time();
+#endif
+        const gfx::srect16 b = (gfx::srect16)this->dimensions().bounds();
+        const gfx::rgba_pixel<32> back = m_pressed ? m_color : m_back_color;
+        const gfx::rgba_pixel<32> fore = m_pressed ? m_back_color : m_color;
+        gfx::draw::filled_rounded_rectangle(dst, b, m_radiuses, back, &clip);
+        gfx::draw::rounded_rectangle(dst, b, m_radiuses, m_border_color, &clip);
+        if (m_text != nullptr && m_font != nullptr) {
+            gfx::text_info ti(m_text, *m_font);
+            gfx::size16 area;
+            if (gfx::gfx_result::success ==
+                m_font->measure((uint16_t)-1, ti, &area)) {
+                gfx::draw::text(dst,
+                                ((gfx::srect16)area.bounds()).center(b), ti,
+                                fore, back, &clip);
+            }
+        }
+#ifdef BUTTON_PAINT_TIMING
+        printf("Button paint: %dus\n", (int)(esp_timer_get_time() - start));
+#endif
+    }
+    virtual bool on_touch(size_t locations_size,
+                          const gfx::spoint16* locations) override {
+        if (!m_pressed) {
+            m_pressed = true;
+            if (m_on_pressed_changed_callback != nullptr) {
+                m_on_pressed_changed_callback(
+                    true, m_on_pressed_changed_callback_state);
+            }
+            this->invalidate();
+        }
+        return true;
+    }
+    virtual void on_release() override {
+        if (m_pressed) {
+            m_pressed = false;
+            if (m_on_pressed_changed_callback != nullptr) {
+                m_on_pressed_changed_callback(
+                    false, m_on_pressed_changed_callback_state);
+            }
+            this->invalidate();
+        }
+    }
+};
+
+// shows every alarm at once as a grid of tiles, drawn from packed alarm
+// bits. only tiles that changed are repainted
+template <typename ControlSurfaceType>
+class alarm_grid : public uix::control<ControlSurfaceType> {
+    using base_type = uix::control<ControlSurfaceType>;
+    using color32_type = gfx::color<gfx::rgba_pixel<32>>;
+
+   public:
+    typedef void (*on_selected_callback_type)(size_t alarm, void* state);
+
+   private:
+    size_t m_count;
+    // the alarm bits as last painted
+    uint32_t* m_values;
+    // the alarms the switches are showing
+    size_t m_page_start;
+    size_t m_page_count;
+    tile_grid m_grid;
+    bool m_dirty;
+    on_selected_callback_type m_on_selected_callback;
+    void* m_on_selected_callback_state;
+    bool value(size_t i) const { return (m_values[i / 32] >> (i % 32)) & 1; }
+    gfx::srect16 tile_bounds(size_t i) const {
+        int x, y;
+        tile_grid_origin(&m_grid, i, &x, &y);
+        return gfx::srect16(x, y, x + m_grid.tile_size - 1,
+                       y + m_grid.tile_size - 1);
+    }
+    void invalidate_range(size_t start, size_t count) {
+        for (size_t i = start; i < start + count && i < m_count; ++i) {
+            this->invalidate(tile_bounds(i));
+        }
+    }
+    // finds the largest tiles that fit all of them
+    void layout() {
+        const gfx::ssize16 dim = this->dimensions();
+        tile_grid_layout(&m_grid, dim.width, dim.height, m_count);
+        m_dirty = false;
+    }
+
+   public:
+    alarm_grid()
+        : base_type(),
+          m_count(0),
+          m_values(nullptr),
+          m_page_start(0),
+          m_page_count(0),
+          m_grid{1, 0, 1},
+          m_dirty(true),
+          m_on_selected_callback(nullptr),
+          m_on_selected_callback_state(nullptr) {}
+    virtual ~alarm_grid() {
+        if (m_values != nullptr) {
+            free(m_values);
+        }
+    }
+    size_t count() const { return m_count; }
+    void count(size_t value) {
+        if (m_values != nullptr) {
+            free(m_values);
+        }
+        m_count = 0;
+        m_values = (uint32_t*)calloc((value + 31) / 32, sizeof(uint32_t));
+        if (m_values != nullptr) {
+            m_count = value;
+        }
+        m_dirty = true;
+        this->invalidate();
+    }
+    // takes the alarm bits, 32 per word, and repaints the tiles that changed
+    void values(const uint32_t* values) {
+        for (size_t w = 0; w < (m_count + 31) / 32; ++w) {
+            uint32_t changed = m_values[w] ^ values[w];
+            m_values[w] = values[w];
+            while (changed) {
+                const size_t i = w * 32 + __builtin_ctz(changed);
+                changed &= changed - 1;
+                if (i < m_count && !m_dirty) {
+                    this->invalidate(tile_bounds(i));
+                }
+            }
+        }
+    }
+    // marks the alarms the switches are showing
+    void page(size_t start, size_t count) {
+        if (start == m_page_start && count == m_page_count) {
+            return;
+        }
+        if (!m_dirty) {
+            invalidate_range(m_page_start, m_page_count);
+            invalidate_range(start, count);
+        }
+        m_page_start = start;
+        m_page_count = count;
+    }
+    void on_selected_callback(on_selected_callback_type callback,
+                              void* state = nullptr) {
+        m_on_selected_callback = callback;
+        m_on_selected_callback_state = state;
+    }
+
+   protected:
+    virtual void on_before_paint() override {
+        if (m_dirty) {
+            layout();
+        }
+    }
+    virtual void on_paint(ControlSurfaceType& dst,
+                          const gfx::srect16& clip) override {
+        if (m_values == nullptr) {
+            return;
+        }
+#ifdef GRID_PAINT_TIMING
+        const int64_t start = esp_timer_get_time();
+        size_t painted = 0;
+#endif
+        // only visit the rows and columns the clip covers
+        size_t col1, row1, col2, row2;
+        tile_grid_span(&m_grid, clip.x1, clip.y1, clip.x2, clip.y2, &col1,
+                       &row1, &col2, &row2);
+        for (size_t row = row1; row <= row2; ++row) {
+            for (size_t col = col1; col <= col2; ++col) {
+                const size_t i = row * m_grid.columns + col;
+                if (i >= m_count) {
+                    break;
+                }
+                const bool paged =
+                    i >= m_page_start && i < m_page_start + m_page_count;
+                const bool on = value(i);
+                gfx::draw::filled_rectangle(
+                    dst, tile_bounds(i),
+                    on ? (paged ? color32_type::orange : color32_type::red)
+                       : (paged ? color32_type::gray
+                                : color32_type::dark_gray),
+                    &clip);
+#ifdef GRID_PAINT_TIMING
+                ++painted;
+#endif
+            }
+        }
+#ifdef GRID_PAINT_TIMING
+        printf("Grid paint: %d of %d tiles in %dus\n", (int)painted,
+               (int)m_count, (int)(esp_timer_get_time() - start));
+#endif
+    }
+    virtual bool on_touch(size_t locations_size,
+                          const gfx::spoint16* locations) override {
+        if (locations_size == 0 || m_on_selected_callback == nullptr) {
+            return true;
+        }
+        size_t i;
+        if (tile_grid_hit(&m_grid, m_count, locations[0].x, locations[0].y,
+                          &i)) {
+            m_on_selected_callback(i, m_on_selected_callback_state);
+        }
+        return true;
+    }
+};
+#endif
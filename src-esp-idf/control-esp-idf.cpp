@@ -31,10 +31,40 @@
 #define LCD_BGR 1                     // optional
 #define LCD_BIT_DEPTH 16              // optional
 #define LCD_SPEED (40 * 1000 * 1000)  // optional
+// the touch panel's interrupt line. without it the panel is polled
+#define TOUCH_INT 39  // optional
+// log the UI loop's busy time and how long after an event the first pixel
+// goes out
+// #define LOOP_TIMING
+// log how long each arrow takes to paint
+// #define ARROW_PAINT_TIMING
+// log how long each text button takes to paint
+// #define BUTTON_PAINT_TIMING
+// log how long the alarm overview grid takes to paint
+// #define GRID_PAINT_TIMING
+// collect frame, flush, DMA wait and touch latency statistics for the
+// display, logged every 10 seconds and served at /api/stats
+// #define FRAME_STATS
+// run the UI loop flat out like it used to, rather than sleeping until
+// something wakes it. for comparing FRAME_STATS touch latency against
+// #define LOOP_SPIN
+// log the median and 99th percentile time to apply /api writes, set and
+// on=/off= alike
+// #define HTTPD_SET_TIMING
+// the core the display and touch run on
+#define UI_CORE 1  // optional
+// the core serial and web work runs on, alongside wifi
+#define IO_CORE 0  // optional
+// log each core's utilization and the frame rate. needs run time stats,
+// which are off by default: pio run -t menuconfig, then Component config >
+// FreeRTOS > Kernel > configGENERATE_RUN_TIME_STATS
+// #define CPU_USAGE_REPORT
 
 #include <sys/stat.h>
 #include <sys/unistd.h>
 
+#include <atomic>
+
 #include <esp_i2c.hpp>  // i2c initialization
 #include <ft6336.hpp>
 #include <gfx.hpp>            // graphics library
@@ -44,25 +74,40 @@
 #include "driver/gpio.h"
 #include "driver/spi_master.h"
 #include "driver/uart.h"
+#include "esp_heap_caps.h"
 #include "esp_http_server.h"
 #include "esp_lcd_panel_ili9342.h"
 #include "esp_lcd_panel_io.h"
 #include "esp_lcd_panel_ops.h"
 #include "esp_lcd_panel_vendor.h"
+#include "esp_random.h"
 #include "esp_spiffs.h"
+#include "esp_timer.h"
 #include "esp_vfs_fat.h"
 #include "esp_wifi.h"
 #include "nvs_flash.h"
 
-// font is a TTF/OTF from downloaded from fontsquirrel.com
-// converted to a header with https://honeythecodewitch.com/gfx/converter
-#define OPENSANS_REGULAR_IMPLEMENTATION
-#include "assets/OpenSans_Regular.h"  // our font
+// fonts are cut down from assets/OpenSans_Regular.h on build by
+// fontgen_extra.py to just the characters the panel draws, prerendered at
+// the size they're drawn so nothing is rasterized from outlines at runtime
+#define OPENSANS_CAPTION_IMPLEMENTATION
+#include "assets/OpenSans_caption.h"  // button captions
+#define OPENSANS_DIGITS_IMPLEMENTATION
+#include "assets/OpenSans_digits.h"  // switch labels
 #define LEFT_ARROW_IMPLEMENTATION
 #include "assets/left_arrow.h"
 #define RIGHT_ARROW_IMPLEMENTATION
 #include "assets/right_arrow.h"
+#include "alarm_bits.h"
+#include "alarm_protocol.h"
 #include "config.h"
+#include "http_bits.h"
+#include "http_etag.h"
+#include "http_query.h"
+#include "http_send_buffer.h"
+#include "serial_frame.h"
+#include "tile_grid.h"
+#include "ui_controls.h"
 
 
 // namespace imports
@@ -73,10 +118,37 @@ using namespace uix;      // user interface
 using color_t = color<rgb_pixel<16>>;     // screen color
 using color32_t = color<rgba_pixel<32>>;  // UIX color
 
-// fonts load from streams, so wrap our array in one
-static const_buffer_stream font_stream(OpenSans_Regular,
-                                       sizeof(OpenSans_Regular));
-static tt_font text_font;
+#ifdef UI_CORE
+static constexpr const BaseType_t ui_core = UI_CORE;
+#else
+static constexpr const BaseType_t ui_core = tskNO_AFFINITY;
+#endif
+#ifdef IO_CORE
+static constexpr const BaseType_t io_core = IO_CORE;
+#else
+static constexpr const BaseType_t io_core = tskNO_AFFINITY;
+#endif
+// without run time stats there's nothing to report from
+#if defined(CPU_USAGE_REPORT) && !CONFIG_FREERTOS_GENERATE_RUN_TIME_STATS
+#warning "CPU_USAGE_REPORT is off: enable run time stats in menuconfig"
+#undef CPU_USAGE_REPORT
+#endif
+
+// fonts load from streams, so wrap our arrays in them
+static const_buffer_stream caption_stream(OpenSans_caption,
+                                          sizeof(OpenSans_caption));
+static const_buffer_stream digits_stream(OpenSans_digits,
+                                         sizeof(OpenSans_digits));
+// the digits are rendered at this size by fontgen_extra.py
+static constexpr const uint16_t digits_size = 40;
+static_assert(LCD_HEIGHT / 6 == digits_size,
+              "update digit_size in fontgen_extra.py to LCD_HEIGHT / 6");
+// and the captions at this one, 4 pixels short of the button height
+static constexpr const uint16_t caption_size = 37;
+static_assert(LCD_WIDTH / 8 + 1 - 4 == caption_size,
+              "update caption_size in fontgen_extra.py to the button height");
+static vlw_font caption_font;
+static vlw_font text_font;
 
 static const_buffer_stream left_stream(left_arrow, sizeof(left_arrow));
 static const_buffer_stream right_stream(right_arrow, sizeof(right_arrow));
@@ -84,136 +156,102 @@ static const_buffer_stream right_stream(right_arrow, sizeof(right_arrow));
 using screen_t = uix::screen<rgb_pixel<LCD_BIT_DEPTH>>;
 using surface_t = screen_t::control_surface_type;
 
-template <typename ControlSurfaceType>
-class arrow_box : public control<ControlSurfaceType> {
-    using base_type = control<ControlSurfaceType>;
-
-   public:
-    typedef void (*on_pressed_changed_callback_type)(bool pressed, void* state);
-
-   private:
-    bool m_pressed;
-    bool m_dirty;
-    sizef m_svg_size;
-    matrix m_fit;
-    on_pressed_changed_callback_type m_on_pressed_changed_callback;
-    void* m_on_pressed_changed_callback_state;
-    stream* m_svg;
-    static rectf correct_aspect(srect16& sr, float aspect) {
-        if (sr.width() > sr.height()) {
-            sr.y2 /= aspect;
-        } else {
-            sr.x2 *= aspect;
-        }
-        return (rectf)sr;
-    }
+static void update_switches();
+static void serial_send_alarm(size_t i);
+static void serial_send_alarms(const uint32_t* changed);
+static void httpd_events_notify();
+static void loop_wake();
 
-   public:
-    arrow_box()
-        : base_type(),
-          m_pressed(false),
-          m_dirty(true),
-          m_on_pressed_changed_callback(nullptr),
-          m_svg(nullptr) {}
-    void svg(stream& svg_stream) {
-        m_svg = &svg_stream;
-        m_dirty = true;
-        this->invalidate();
-    }
-    stream& svg() const { return *m_svg; }
-    bool pressed() const { return m_pressed; }
-    void on_pressed_changed_callback(on_pressed_changed_callback_type callback,
-                                     void* state = nullptr) {
-        m_on_pressed_changed_callback = callback;
-        m_on_pressed_changed_callback_state = state;
-    }
+// serializes alarm writers across both cores
+struct alarm_write_mux {
+    portMUX_TYPE mux = portMUX_INITIALIZER_UNLOCKED;
+    void lock() { portENTER_CRITICAL(&mux); }
+    void unlock() { portEXIT_CRITICAL(&mux); }
+};
+// the alarm states, which the UI and the web server snapshot from any task
+// without blocking the writer
+using alarm_store_t = alarm_bits<alarm_count, alarm_write_mux>;
+using alarm_snapshot = alarm_store_t::snapshot;
+static constexpr const size_t alarm_words = alarm_store_t::words;
+static alarm_store_t alarm_store;
 
-   protected:
-    virtual void on_before_paint() override {
-        if (m_dirty) {
-            m_svg_size = {0.f, 0.f};
-            if (m_svg != nullptr) {
-                m_svg->seek(0);
-                canvas::svg_dimensions(*m_svg, &m_svg_size);
-                srect16 sr = this->dimensions().bounds();
-                ssize16 dim = this->dimensions();
-                const float xo = dim.width / 8;
-                const float yo = dim.height / 8;
-                rectf corrected = correct_aspect(sr, m_svg_size.aspect_ratio())
-                                      .inflate(-xo, -yo);
-                m_fit = matrix::create_fit_to(
-                    m_svg_size,
-                    corrected.offset((dim.width - corrected.width()) * .5f +
-                                         (xo * m_pressed),
-                                     (dim.height - corrected.height()) * .5f +
-                                         (yo * m_pressed)));
-            }
-            m_dirty = false;
-        }
+static void alarm_get_snapshot(alarm_snapshot* out_snapshot) {
+    alarm_store.get_snapshot(out_snapshot);
+}
+static void alarm_enable(size_t alarm, bool on) {
+    if (alarm_store.set(alarm, on)) {
+        serial_send_alarm(alarm);
+        httpd_events_notify();
     }
-    virtual void on_paint(ControlSurfaceType& dst,
-                          const srect16& clip) override {
-        if (m_dirty || m_svg == nullptr) {
-            puts("Paint not ready");
+}
+static void alarm_changed(const uint32_t* changed) {
+    for (size_t i = 0; i < alarm_words; ++i) {
+        if (changed[i]) {
+            serial_send_alarms(changed);
+            httpd_events_notify();
             return;
         }
-        canvas cvs((size16)this->dimensions());
-        cvs.initialize();
-        draw::canvas(dst, cvs);
-        m_svg->seek(0);
-        if (gfx_result::success != cvs.render_svg(*m_svg, m_fit)) {
-            puts("SVG render error");
-        }
-    }
-    virtual bool on_touch(size_t locations_size,
-                          const spoint16* locations) override {
-        if (!m_pressed) {
-            m_pressed = true;
-            if (m_on_pressed_changed_callback != nullptr) {
-                m_on_pressed_changed_callback(
-                    true, m_on_pressed_changed_callback_state);
-            }
-            m_dirty = true;
-            this->invalidate();
-        }
-        return true;
     }
-    virtual void on_release() override {
-        if (m_pressed) {
-            m_pressed = false;
-            if (m_on_pressed_changed_callback != nullptr) {
-                m_on_pressed_changed_callback(
-                    false, m_on_pressed_changed_callback_state);
-            }
-            m_dirty = true;
-            this->invalidate();
-        }
+}
+// sets every alarm at once from a packed array of <alarm_words> words
+// with <expected_version>, does nothing and returns false unless that's
+// still the current version
+static bool alarm_enable_all(const uint32_t* values,
+                             const uint32_t* expected_version = nullptr) {
+    uint32_t changed[alarm_words] = {};
+    if (!alarm_store.set_all(values, expected_version, changed)) {
+        return false;
     }
-};
-
-static void update_switches(bool lock = true);
-static void serial_send_alarm(size_t i);
-
-static bool alarm_values[alarm_count];
-
-static void alarm_enable(size_t alarm, bool on) {
-    if (alarm < 0 || alarm >= alarm_count) return;
-    if (alarm_values[alarm] != on) {
-        alarm_values[alarm] = on;
-        serial_send_alarm(alarm);
+    alarm_changed(changed);
+    return true;
+}
+// sets every alarm from <values>, if not null, then applies <ranges> on
+// top, all in one write. takes <expected_version> like alarm_enable_all()
+static bool alarm_enable_apply(const uint32_t* values,
+                               const alarm_range* ranges, size_t count,
+                               const uint32_t* expected_version = nullptr) {
+    uint32_t changed[alarm_words] = {};
+    if (!alarm_store.apply(values, ranges, count, expected_version,
+                           changed)) {
+        return false;
     }
+    alarm_changed(changed);
+    return true;
 }
 
 static void httpd_send_block(const char* data, size_t len, void* arg);
 static void httpd_send_expr(int expr, void* arg);
 static void httpd_send_expr(const char* expr, void* arg);
+static void httpd_send_end(void* arg);
 
 #define HTTPD_CONTENT_IMPLEMENTATION
 #include "httpd_content.h"
 
 static uix::display lcd;
 
+static serial_frame_decoder serial_decoder;
+static QueueHandle_t serial_queue = nullptr;
+static void serial_task(void* arg);
+// alarms waiting to be sent to the slave
+static std::atomic<uint32_t> serial_tx_dirty[alarm_words];
+// frames sent, and alarm changes folded into a send that was already
+// pending for that alarm. reported by /api/stats
+static std::atomic<uint32_t> serial_tx_sent;
+static std::atomic<uint32_t> serial_tx_coalesced;
+static TaskHandle_t serial_tx_handle = nullptr;
+static void serial_tx_task(void* arg);
+// the protocol version both sides speak. 1 until the slave says otherwise
+static std::atomic<uint8_t> serial_peer_version(1);
+static void serial_write_hello(bool request);
+// set when the alarms changed outside the UI so it picks them up on its next
+// pass. the UI task is the only one that touches the controls
+static std::atomic_bool switches_dirty;
+static void switches_refresh() {
+    switches_dirty = true;
+    loop_wake();
+}
 static void serial_init() {
+    serial_frame_decoder_init(&serial_decoder);
     uart_config_t uart_config;
     memset(&uart_config, 0, sizeof(uart_config));
     uart_config.baud_rate = serial_baud_rate;
@@ -221,33 +259,211 @@ static void serial_init() {
     uart_config.parity = UART_PARITY_DISABLE;
     uart_config.stop_bits = UART_STOP_BITS_1;
     uart_config.flow_ctrl = UART_HW_FLOWCTRL_DISABLE;
-    ESP_ERROR_CHECK(uart_driver_install(UART_NUM_1, 256, 0, 20, nullptr, 0));
+    // with a TX buffer, writes are queued to the driver instead of waiting
+    // on the FIFO
+    ESP_ERROR_CHECK(
+        uart_driver_install(UART_NUM_1, 256, 512, 20, &serial_queue, 0));
     uart_param_config(UART_NUM_1, &uart_config);
     uart_set_pin(UART_NUM_1, control_serial_pins.tx, control_serial_pins.rx,
                  UART_PIN_NO_CHANGE, UART_PIN_NO_CHANGE);
+    // higher priority than the render loop so incoming frames never wait
+    // on a screen update
+    xTaskCreatePinnedToCore(serial_task, "serial_task", 4096, nullptr, 12,
+                            nullptr, io_core);
+    xTaskCreatePinnedToCore(serial_tx_task, "serial_tx_task", 4096, nullptr,
+                            11, &serial_tx_handle, io_core);
+    // find out what the slave speaks
+    serial_write_hello(true);
 }
-struct serial_event {
-    COMMAND_ID cmd;
-    uint8_t arg;
-};
-static bool serial_get_event(serial_event* out_event) {
-    uint8_t payload[2];
-    if (out_event && sizeof(payload) == uart_read_bytes(UART_NUM_1, &payload,
-                                                        sizeof(payload), 0)) {
-        out_event->cmd = (COMMAND_ID)payload[0];
-        out_event->arg = payload[1];
-        return true;
+static void serial_write_frame(const uint8_t* payload, size_t size) {
+    uint8_t frame[serial_frame_max_size];
+    const size_t frame_size = serial_frame_encode(payload, size, frame);
+    if (frame_size) {
+        uart_write_bytes(UART_NUM_1, frame, frame_size);
+    }
+}
+static void serial_write_hello(bool request) {
+    uint8_t payload[3];
+    serial_write_frame(payload, alarm_protocol_write_hello(request, payload));
+}
+static void serial_alarm_thrown(size_t i, int64_t received) {
+    alarm_enable(i, true);
+    switches_refresh();
+    printf("alarm #%d thrown (%dus after receipt)\n", (int)i + 1,
+           (int)(esp_timer_get_time() - received));
+}
+static void serial_dispatch(const uint8_t* payload, size_t size,
+                            int64_t received) {
+    switch (payload[0]) {
+        case ALARM_THROWN:
+        case ALARM_THROWN16: {
+            alarm_protocol_command command;
+            if (alarm_protocol_read(payload, size, &command)) {
+                serial_alarm_thrown(command.first, received);
+            }
+        } break;
+        case HELLO: {
+            uint8_t version;
+            bool request;
+            if (alarm_protocol_read_hello(payload, size, &version, &request)) {
+                serial_peer_version = version;
+                printf("Slave speaks protocol version %d\n", (int)payload[1]);
+                if (request) {
+                    serial_write_hello(false);
+                }
+            }
+        } break;
+        default:
+            puts("Unknown event received");
+            break;
+    }
+}
+// drains everything the UART driver has buffered, dispatching each
+// complete frame
+static void serial_poll(int64_t received) {
+    uint8_t buffer[64];
+    size_t available = 0;
+    const unsigned long errors = serial_decoder.errors;
+    uart_get_buffered_data_len(UART_NUM_1, &available);
+    while (available) {
+        const int read = uart_read_bytes(
+            UART_NUM_1, buffer,
+            available < sizeof(buffer) ? available : sizeof(buffer), 0);
+        if (read <= 0) {
+            break;
+        }
+        for (int i = 0; i < read; ++i) {
+            const uint8_t* payload;
+            size_t size;
+            if (serial_frame_decode(&serial_decoder, buffer[i], &payload,
+                                    &size)) {
+                serial_dispatch(payload, size, received);
+            }
+        }
+        available -= read;
+    }
+    if (serial_decoder.errors != errors) {
+        printf("Dropped %lu bad serial frame(s)\n",
+               serial_decoder.errors - errors);
+    }
+}
+static void serial_task(void* arg) {
+    uart_event_t event;
+    while (1) {
+        if (!xQueueReceive(serial_queue, &event, portMAX_DELAY)) {
+            continue;
+        }
+        switch (event.type) {
+            case UART_DATA:
+                serial_poll(esp_timer_get_time());
+                break;
+            case UART_FIFO_OVF:
+            case UART_BUFFER_FULL:
+                // we fell behind. start over at the next frame
+                puts("Serial receive overflow");
+                uart_flush_input(UART_NUM_1);
+                xQueueReset(serial_queue);
+                break;
+            default:
+                break;
+        }
+    }
+}
+// returns the number of frames written
+static size_t serial_write_alarm(size_t i, bool on) {
+    if (i >= alarm_count) return 0;
+    uint8_t payload[3];
+    const size_t size = alarm_protocol_write_alarm(
+        i, on, serial_peer_version >= 2, payload);
+    if (size == 0) {
+        return 0;
+    }
+    serial_write_frame(payload, size);
+    return 1;
+}
+// writes the given range of alarms as SET_ALARMS frames. returns the number
+// of frames written
+static size_t serial_write_alarms(const uint32_t* values, size_t start,
+                                  size_t count) {
+    const bool wide = serial_peer_version >= 2;
+    uint8_t payload[alarm_protocol_max_payload];
+    size_t result = 0;
+    while (count) {
+        size_t n;
+        // a version 1 slave can only address the first 256
+        const size_t size = alarm_protocol_write_alarms(values, start, count,
+                                                        wide, payload, &n);
+        if (size == 0) {
+            break;
+        }
+        serial_write_frame(payload, size);
+        ++result;
+        start += n;
+        count -= n;
+    }
+    return result;
+}
+// queues alarms to be sent to the slave. the sender task sends whatever
+// state they are in by the time it gets to them, so an alarm that flips
+// several times before then only goes out once
+// marks the <changed> bits of word <word> to be sent by the next
+// serial_send_marked()
+static void serial_mark_alarms(size_t word, uint32_t changed) {
+    const uint32_t pending = serial_tx_dirty[word].fetch_or(changed);
+    // a version 1 slave never gets the ones past 256, so they don't count
+    if ((pending & changed) && (serial_peer_version >= 2 || word < 256 / 32)) {
+        serial_tx_coalesced += __builtin_popcount(pending & changed);
+    }
+}
+static void serial_send_marked() {
+    if (serial_tx_handle != nullptr) {
+        xTaskNotifyGive(serial_tx_handle);
     }
-    return false;
+}
+static void serial_send_alarms(const uint32_t* changed) {
+    for (size_t i = 0; i < alarm_words; ++i) {
+        if (changed[i]) {
+            serial_mark_alarms(i, changed[i]);
+        }
+    }
+    serial_send_marked();
 }
 static void serial_send_alarm(size_t i) {
     if (i >= alarm_count) return;
-    printf("%s alarm #%d\n", alarm_values[i] ? "setting" : "clearing",
-           (int)i + 1);
-    uint8_t payload[2];
-    payload[0] = alarm_values[i] ? SET_ALARM : CLEAR_ALARM;
-    payload[1] = i;
-    uart_write_bytes(UART_NUM_1, payload, sizeof(payload));
+    serial_mark_alarms(i / 32, UINT32_C(1) << (i % 32));
+    serial_send_marked();
+}
+static void serial_tx_task(void* arg) {
+    uint32_t dirty[alarm_words];
+    alarm_snapshot snap;
+    while (1) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        for (size_t i = 0; i < alarm_words; ++i) {
+            dirty[i] = serial_tx_dirty[i].exchange(0);
+        }
+        alarm_get_snapshot(&snap);
+        const bool wide = serial_peer_version >= 2;
+        size_t sent = 0;
+        // each run goes as single alarm frames or as masks, whichever is
+        // fewer bytes
+        alarm_protocol_run run;
+        size_t start = 0;
+        while (alarm_protocol_next_run(dirty, alarm_count, start, wide,
+                                       &run)) {
+            if (run.mask) {
+                sent += serial_write_alarms(snap.values, run.first,
+                                            run.last - run.first + 1);
+            } else {
+                for (size_t i = run.first; i <= run.last; ++i) {
+                    if ((dirty[i / 32] >> (i % 32)) & 1) {
+                        sent += serial_write_alarm(i, snap.value(i));
+                    }
+                }
+            }
+            start = run.last + 1;
+        }
+        serial_tx_sent += sent;
+    }
 }
 
 static constexpr const EventBits_t wifi_connected_bit = BIT0;
@@ -269,6 +485,7 @@ static void wifi_event_handler(void* arg, esp_event_base_t event_base,
         } else {
             puts("wifi connection failed");
             xEventGroupSetBits(wifi_event_group, wifi_fail_bit);
+            loop_wake();
         }
     } else if (event_base == IP_EVENT && event_id == IP_EVENT_STA_GOT_IP) {
         puts("got IP address");
@@ -276,6 +493,7 @@ static void wifi_event_handler(void* arg, esp_event_base_t event_base,
         ip_event_got_ip_t* event = (ip_event_got_ip_t*)event_data;
         memcpy(&wifi_ip, &event->ip_info.ip, sizeof(wifi_ip));
         xEventGroupSetBits(wifi_event_group, wifi_connected_bit);
+        loop_wake();
     }
 }
 static bool wifi_load(const char* path, char* ssid, char* pass) {
@@ -345,137 +563,615 @@ static WIFI_STATUS wifi_status() {
 }
 
 static httpd_handle_t httpd_handle = nullptr;
-static SemaphoreHandle_t httpd_ui_sync = nullptr;
+#ifdef HTTPD_SET_TIMING
+static constexpr const size_t httpd_set_timing_count = 128;
+static uint32_t httpd_set_timings[httpd_set_timing_count];
+static size_t httpd_set_timing_index = 0;
+static int httpd_set_timing_compare(const void* lhs, const void* rhs) {
+    const uint32_t l = *(const uint32_t*)lhs, r = *(const uint32_t*)rhs;
+    return l < r ? -1 : (l > r ? 1 : 0);
+}
+static void httpd_set_timing_add(uint32_t us) {
+    httpd_set_timings[httpd_set_timing_index++] = us;
+    if (httpd_set_timing_index == httpd_set_timing_count) {
+        httpd_set_timing_index = 0;
+        qsort(httpd_set_timings, httpd_set_timing_count, sizeof(uint32_t),
+              httpd_set_timing_compare);
+        printf("/api writes p50: %uus, p99: %uus\n",
+               (unsigned)httpd_set_timings[httpd_set_timing_count / 2],
+               (unsigned)httpd_set_timings[httpd_set_timing_count * 99 / 100]);
+    }
+}
+#endif
+// responses are collected and sent a TCP segment at a time rather than
+// one socket send per block or expression
+#ifdef CONFIG_LWIP_TCP_MSS
+static constexpr const size_t httpd_send_buffer_size = CONFIG_LWIP_TCP_MSS;
+#else
+static constexpr const size_t httpd_send_buffer_size = 1436;
+#endif
 struct httpd_async_resp_arg {
     httpd_handle_t hd;
     int fd;
+    http_send_buffer out;
+    char send_buffer[httpd_send_buffer_size];
 };
-static void httpd_send_chunked(httpd_async_resp_arg* resp_arg,
-                               const char* buffer, size_t buffer_len) {
-    char buf[64];
-    httpd_handle_t hd = resp_arg->hd;
-    int fd = resp_arg->fd;
-    if (buffer && buffer_len) {
-        itoa(buffer_len, buf, 16);
-        strcat(buf, "\r\n");
-        httpd_socket_send(hd, fd, buf, strlen(buf), 0);
-        httpd_socket_send(hd, fd, buffer, buffer_len, 0);
-        httpd_socket_send(hd, fd, "\r\n", 2, 0);
-        return;
-    }
-    httpd_socket_send(hd, fd, "0\r\n\r\n", 5, 0);
+static void httpd_send_socket(const char* data, size_t size, void* state) {
+    httpd_async_resp_arg* resp_arg = (httpd_async_resp_arg*)state;
+    httpd_socket_send(resp_arg->hd, resp_arg->fd, data, size, 0);
 }
 
-static const char* httpd_crack_query(const char* url_part, char* name,
-                                     char* value) {
-    if (url_part == nullptr || !*url_part) return nullptr;
-    const char start = *url_part;
-    if (start == '&' || start == '?') {
-        ++url_part;
-    }
-    size_t i = 0;
-    char* name_cur = name;
-    while (*url_part && *url_part != '=' && *url_part!='&') {
-        if (i < 64) {
-            *name_cur++ = *url_part;
+// the most on= and off= runs one request can make
+static constexpr const size_t httpd_ranges_max = 64;
+// parses a list like 3,7,10-20 onto <ranges>. alarms past the end are
+// ignored. returns false if it's malformed or there are too many runs
+static bool httpd_parse_ranges(http_query_part list, bool on,
+                               alarm_range* ranges, size_t* in_out_count) {
+    uint32_t first, last;
+    bool error;
+    while (http_query_next_range(&list, &first, &last, &error)) {
+        if (first >= alarm_count) {
+            continue;
+        }
+        if (last >= alarm_count) {
+            last = alarm_count - 1;
         }
-        ++url_part;
-        ++i;
-    }
-    *name_cur = '\0';
-    if (!*url_part || *url_part=='&') {
-        *value = '\0';
-        return url_part;
-    }
-    ++url_part;
-    i = 0;
-    char* value_cur = value;
-    while (*url_part && *url_part != '&') {
-        if(i<64) {
-            *value_cur++ = *url_part;    
+        if (*in_out_count == httpd_ranges_max) {
+            return false;
         }
-        ++url_part;
-        ++i;
+        alarm_range& r = ranges[(*in_out_count)++];
+        r.first = (uint16_t)first;
+        r.last = (uint16_t)last;
+        r.on = on;
     }
-    *value_cur = '\0';
-    return url_part;
+    return !error;
 }
-static void httpd_parse_url_and_apply_alarms(const char* url) {
+// applies ?set&a=..., which replaces every alarm, and on=/off=, which only
+// change the alarms listed. with expect=<version>, nothing is applied unless
+// that's still the current version. returns ESP_ERR_INVALID_ARG for a bad
+// list and ESP_ERR_INVALID_STATE if the version didn't match
+static esp_err_t httpd_parse_url_and_apply_alarms(const char* url) {
+#ifdef HTTPD_SET_TIMING
+    const int64_t start = esp_timer_get_time();
+#endif
     const char* query = strchr(url, '?');
+    if (query == nullptr) {
+        return ESP_OK;
+    }
     bool has_set = false;
-    char name[64];
-    char value[64];
-    bool req_values[alarm_count];
-    if (query != nullptr) {
-        memset(req_values, 0, sizeof(req_values));
-        while (1) {
-            query = httpd_crack_query(query, name, value);
-            if (!query) {
-                break;
+    bool has_values = false;
+    bool has_expect = false;
+    uint32_t expect = 0;
+    uint32_t req_values[alarm_words];
+    alarm_range ranges[httpd_ranges_max];
+    size_t ranges_count = 0;
+    http_query_param param;
+    while ((query = http_query_next(query, &param)) != nullptr) {
+        if (http_query_equals(param.name, "set")) {
+            has_set = true;
+        } else if (http_query_equals(param.name, "a")) {
+            if (!has_values) {
+                memset(req_values, 0, sizeof(req_values));
+                has_values = true;
             }
-            if (!strcmp("set", name)) {
-                has_set = true;
-            } else if (!strcmp("a", name)) {
-                char* endsz;
-                long l = strtol(value, &endsz, 10);
-                if (l >= 0 && l < alarm_count) {
-                    req_values[l] = true;
-                }
+            uint32_t i;
+            if (http_query_uint(param.value, &i) && i < alarm_count) {
+                req_values[i / 32] |= (UINT32_C(1) << (i % 32));
+            }
+        } else if (http_query_equals(param.name, "on") ||
+                   http_query_equals(param.name, "off")) {
+            if (!httpd_parse_ranges(param.value,
+                                    http_query_equals(param.name, "on"),
+                                    ranges, &ranges_count)) {
+                return ESP_ERR_INVALID_ARG;
             }
+        } else if (http_query_equals(param.name, "expect")) {
+            if (!http_query_uint(param.value, &expect)) {
+                return ESP_ERR_INVALID_ARG;
+            }
+            has_expect = true;
         }
     }
-    if (has_set) {
-        for (size_t i = 0; i < alarm_count; ++i) {
-            alarm_enable(i, req_values[i]);
-        }
-        update_switches();
+    if (!has_set && ranges_count == 0 && !has_expect) {
+        return ESP_OK;
+    }
+    if (has_set && !has_values) {
+        memset(req_values, 0, sizeof(req_values));
     }
+    // on= and off= go on top of set, in the same write, so nobody sees the
+    // state in between and expect= covers all of it
+    if (!alarm_enable_apply(has_set ? req_values : nullptr, ranges,
+                            ranges_count, has_expect ? &expect : nullptr)) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    // the UI applies it between frames. we don't wait on it
+    switches_refresh();
+#ifdef HTTPD_SET_TIMING
+    httpd_set_timing_add((uint32_t)(esp_timer_get_time() - start));
+#endif
+    return ESP_OK;
 }
 static void httpd_send_block(const char* data, size_t len, void* arg) {
     if (!data || !*data || !len) {
         return;
     }
     httpd_async_resp_arg* resp_arg = (httpd_async_resp_arg*)arg;
-    httpd_socket_send(resp_arg->hd, resp_arg->fd, data, len, 0);
+    http_send_buffer_write(&resp_arg->out, data, len);
 }
 static void httpd_send_expr(int expr, void* arg) {
     httpd_async_resp_arg* resp_arg = (httpd_async_resp_arg*)arg;
     char buf[64];
     itoa(expr, buf, 10);
-    httpd_send_chunked(resp_arg, buf, strlen(buf));
+    http_send_buffer_chunk(&resp_arg->out, buf, strlen(buf));
 }
 static void httpd_send_expr(const char* expr, void* arg) {
     httpd_async_resp_arg* resp_arg = (httpd_async_resp_arg*)arg;
     if (!expr || !*expr) {
         return;
     }
-    httpd_send_chunked(resp_arg, expr, strlen(expr));
+    http_send_buffer_chunk(&resp_arg->out, expr, strlen(expr));
+}
+static void httpd_send_end(void* arg) {
+    httpd_async_resp_arg* resp_arg = (httpd_async_resp_arg*)arg;
+    http_send_buffer_flush(&resp_arg->out);
+    free(resp_arg);
+}
+
+static constexpr const size_t httpd_max_open_sockets =
+    CONFIG_LWIP_MAX_SOCKETS - 3;
+// event subscribers and long polls both hold their socket open, so they
+// draw on one budget that leaves two sockets for everything else. only
+// touched from the httpd task
+static constexpr const size_t httpd_held_max = httpd_max_open_sockets - 2;
+static size_t httpd_held_count = 0;
+static bool httpd_held_acquire() {
+    if (httpd_held_count == httpd_held_max) {
+        return false;
+    }
+    ++httpd_held_count;
+    return true;
+}
+static void httpd_held_release() {
+    --httpd_held_count;
+}
+// browsers subscribed to /api/events (server sent events)
+// the subscriber list is only touched from the httpd task
+static constexpr const size_t httpd_events_max_subscribers = httpd_held_max;
+static int httpd_events_fds[httpd_events_max_subscribers];
+static std::atomic_bool httpd_events_pending;
+// formats the alarm status document between <prefix> and <suffix>
+static char* httpd_status_format(const alarm_snapshot& snap,
+                                 const char* prefix, const char* suffix,
+                                 size_t* out_len) {
+    const size_t prefix_len = strlen(prefix);
+    const size_t suffix_len = strlen(suffix);
+    char* result =
+        (char*)malloc(prefix_len + suffix_len + 1 + (alarm_count * 6));
+    if (result == nullptr) {
+        return nullptr;
+    }
+    char* p = result;
+    memcpy(p, prefix, prefix_len);
+    p += prefix_len;
+    for (size_t i = 0; i < alarm_count; ++i) {
+        if (i > 0) {
+            *p++ = ',';
+        }
+        const char* sz = snap.value(i) ? "true" : "false";
+        const size_t len = strlen(sz);
+        memcpy(p, sz, len);
+        p += len;
+    }
+    memcpy(p, suffix, suffix_len);
+    p += suffix_len;
+    *p = '\0';
+    *out_len = p - result;
+    return result;
+}
+static char* httpd_events_format(size_t* out_len) {
+    alarm_snapshot snap;
+    alarm_get_snapshot(&snap);
+    return httpd_status_format(snap, "data: {\"status\":[", "]}\n\n",
+                               out_len);
+}
+// the last /api body, rebuilt only when the alarms change. only touched from
+// the httpd task
+static char* httpd_api_body = nullptr;
+static size_t httpd_api_body_len = 0;
+static uint32_t httpd_api_body_version = 0;
+// part of every ETag so tags from before a restart never match
+static uint32_t httpd_etag_boot = 0;
+// <out_etag> must hold 24 characters
+static void httpd_api_etag(uint32_t version, char* out_etag) {
+    http_etag_format(httpd_etag_boot, version, out_etag);
+}
+static bool httpd_api_body_update(const alarm_snapshot& snap) {
+    if (httpd_api_body != nullptr && httpd_api_body_version == snap.version) {
+        return true;
+    }
+    char prefix[32];
+    snprintf(prefix, sizeof(prefix), "{\"version\":%u,\"status\":[",
+             (unsigned)snap.version);
+    size_t len;
+    char* body = httpd_status_format(snap, prefix, "]}", &len);
+    if (body == nullptr) {
+        return false;
+    }
+    free(httpd_api_body);
+    httpd_api_body = body;
+    httpd_api_body_len = len;
+    httpd_api_body_version = snap.version;
+    return true;
+}
+// answers a parked /api request directly on its socket
+static void httpd_api_send(int fd, const alarm_snapshot& snap) {
+    if (!httpd_api_body_update(snap)) {
+        httpd_sess_trigger_close(httpd_handle, fd);
+        return;
+    }
+    char etag[http_etag_size];
+    httpd_api_etag(snap.version, etag);
+    char header[160];
+    const int len = snprintf(header, sizeof(header),
+                             "HTTP/1.1 200 OK\r\nContent-Type: "
+                             "application/json\r\nContent-Length: %u\r\n"
+                             "ETag: %s\r\nCache-Control: no-cache\r\n\r\n",
+                             (unsigned)httpd_api_body_len, etag);
+    if (0 > httpd_socket_send(httpd_handle, fd, header, len, 0) ||
+        0 > httpd_socket_send(httpd_handle, fd, httpd_api_body,
+                              httpd_api_body_len, 0)) {
+        httpd_sess_trigger_close(httpd_handle, fd);
+    }
+}
+
+// /api?wait= requests parked until the alarms change or they time out
+// the waiter list is only touched from the httpd task
+struct httpd_waiter {
+    int fd;
+    uint32_t version;
+    int64_t deadline;
+};
+static constexpr const size_t httpd_waiters_max = httpd_held_max;
+static constexpr const uint32_t httpd_wait_default_ms = 30 * 1000;
+static constexpr const uint32_t httpd_wait_max_ms = 60 * 1000;
+static httpd_waiter httpd_waiters[httpd_waiters_max];
+// fires at the earliest deadline
+static esp_timer_handle_t httpd_waiters_timer = nullptr;
+static void httpd_waiters_arm() {
+    int64_t next = INT64_MAX;
+    for (size_t i = 0; i < httpd_waiters_max; ++i) {
+        const httpd_waiter& w = httpd_waiters[i];
+        if (w.fd > -1 && w.deadline < next) {
+            next = w.deadline;
+        }
+    }
+    // fails harmlessly if it isn't running
+    esp_timer_stop(httpd_waiters_timer);
+    if (next != INT64_MAX) {
+        const int64_t now = esp_timer_get_time();
+        esp_timer_start_once(httpd_waiters_timer, next > now ? next - now : 1);
+    }
+}
+// answers the waiters that have a new version or have run out of time
+static void httpd_waiters_wake(void* arg) {
+    alarm_snapshot snap;
+    alarm_get_snapshot(&snap);
+    const int64_t now = esp_timer_get_time();
+    for (size_t i = 0; i < httpd_waiters_max; ++i) {
+        httpd_waiter& w = httpd_waiters[i];
+        if (w.fd > -1 && (w.version != snap.version || now >= w.deadline)) {
+            const int fd = w.fd;
+            w.fd = -1;
+            httpd_held_release();
+            httpd_api_send(fd, snap);
+        }
+    }
+    httpd_waiters_arm();
+}
+static void httpd_waiters_timeout(void* arg) {
+    // runs on the timer task. the waiters belong to the httpd task
+    if (httpd_handle != nullptr) {
+        httpd_queue_work(httpd_handle, httpd_waiters_wake, nullptr);
+    }
+}
+static bool httpd_waiters_add(int fd, uint32_t version, uint32_t timeout_ms) {
+    if (!httpd_held_acquire()) {
+        return false;
+    }
+    for (size_t i = 0; i < httpd_waiters_max; ++i) {
+        httpd_waiter& w = httpd_waiters[i];
+        if (w.fd == -1) {
+            w.fd = fd;
+            w.version = version;
+            w.deadline = esp_timer_get_time() + (int64_t)timeout_ms * 1000;
+            httpd_waiters_arm();
+            return true;
+        }
+    }
+    httpd_held_release();
+    return false;
 }
 
+static void httpd_events_send(void* arg) {
+    httpd_events_pending = false;
+    // long polls wait on the same changes
+    httpd_waiters_wake(nullptr);
+    size_t len;
+    char* msg = httpd_events_format(&len);
+    if (msg == nullptr) {
+        return;
+    }
+    for (size_t i = 0; i < httpd_events_max_subscribers; ++i) {
+        const int fd = httpd_events_fds[i];
+        if (fd > -1 && 0 > httpd_socket_send(httpd_handle, fd, msg, len, 0)) {
+            // the browser went away. the close handler will remove it
+            httpd_sess_trigger_close(httpd_handle, fd);
+        }
+    }
+    free(msg);
+}
+static void httpd_events_notify() {
+    // coalesce changes made before the httpd task gets to them
+    if (httpd_handle != nullptr && !httpd_events_pending.exchange(true)) {
+        if (ESP_OK != httpd_queue_work(httpd_handle, httpd_events_send,
+                                       nullptr)) {
+            httpd_events_pending = false;
+        }
+    }
+}
+static esp_err_t httpd_events_handler(httpd_req_t* req) {
+    static const char header[] =
+        "HTTP/1.1 200 OK\r\nContent-Type: text/event-stream\r\nCache-Control: "
+        "no-cache\r\nConnection: keep-alive\r\n\r\n";
+    const int fd = httpd_req_to_sockfd(req);
+    if (fd < 0) {
+        return ESP_FAIL;
+    }
+    // out of sockets to hold. the client will fall back to polling
+    if (!httpd_held_acquire()) {
+        httpd_resp_set_status(req, "503 Service Unavailable");
+        httpd_resp_set_hdr(req, "Retry-After", "10");
+        httpd_resp_set_type(req, "text/plain");
+        return httpd_resp_sendstr(req, "Too many subscribers");
+    }
+    for (size_t i = 0; i < httpd_events_max_subscribers; ++i) {
+        if (httpd_events_fds[i] == -1) {
+            httpd_socket_send(req->handle, fd, header, sizeof(header) - 1, 0);
+            // send the current state up front
+            size_t len;
+            char* msg = httpd_events_format(&len);
+            if (msg != nullptr) {
+                httpd_socket_send(req->handle, fd, msg, len, 0);
+                free(msg);
+            }
+            httpd_events_fds[i] = fd;
+            return ESP_OK;
+        }
+    }
+    // can't happen. there's a slot for every socket in the budget
+    httpd_held_release();
+    return ESP_FAIL;
+}
+static void httpd_close_handler(httpd_handle_t hd, int fd) {
+    for (size_t i = 0; i < httpd_events_max_subscribers; ++i) {
+        if (httpd_events_fds[i] == fd) {
+            httpd_events_fds[i] = -1;
+            httpd_held_release();
+        }
+    }
+    for (size_t i = 0; i < httpd_waiters_max; ++i) {
+        if (httpd_waiters[i].fd == fd) {
+            httpd_waiters[i].fd = -1;
+            httpd_held_release();
+        }
+    }
+    close(fd);
+}
+#ifdef FRAME_STATS
+static char* lcd_stats_format(size_t* out_len);
+static esp_err_t httpd_stats_handler(httpd_req_t* req) {
+    size_t len;
+    char* json = lcd_stats_format(&len);
+    if (json == nullptr) {
+        httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR,
+                            "Out of memory");
+        return ESP_FAIL;
+    }
+    httpd_resp_set_type(req, "application/json");
+    httpd_resp_set_hdr(req, "Cache-Control", "no-cache");
+    httpd_resp_send(req, json, len);
+    free(json);
+    return ESP_OK;
+}
+#endif
+// the response only keeps a pointer to its headers until it's sent, so the
+// tag can't live on the stack. requests are handled one at a time on the
+// httpd task, so one will do
+static char httpd_api_tag_etag[http_etag_size];
+// tags the response with <version>. returns true if the client already has
+// it
+static bool httpd_api_tag(httpd_req_t* req, uint32_t version) {
+    httpd_api_etag(version, httpd_api_tag_etag);
+    httpd_resp_set_hdr(req, "ETag", httpd_api_tag_etag);
+    // browsers keep the body but check back with us every time
+    httpd_resp_set_hdr(req, "Cache-Control", "no-cache");
+    char match[128];
+    return ESP_OK == httpd_req_get_hdr_value_str(req, "If-None-Match", match,
+                                                 sizeof(match)) &&
+           http_etag_match(match, httpd_api_tag_etag);
+}
+// /api, tagged with the alarm version. pollers that already have the current
+// state get a 304 with no body. with wait=<version> the request is parked
+// until the version moves on from that, or timeout=<ms> runs out. <conflict>
+// answers a failed expect=<version> with a 409 and the current state
+static esp_err_t httpd_api_handler(httpd_req_t* req, bool conflict) {
+    const char* query = strchr(req->uri, '?');
+    bool wait = false;
+    uint32_t wait_version = 0;
+    uint32_t timeout_ms = httpd_wait_default_ms;
+    http_query_param param;
+    while ((query = http_query_next(query, &param)) != nullptr) {
+        if (http_query_equals(param.name, "wait")) {
+            wait = http_query_uint(param.value, &wait_version);
+        } else if (http_query_equals(param.name, "timeout")) {
+            http_query_uint(param.value, &timeout_ms);
+        }
+    }
+    alarm_snapshot snap;
+    alarm_get_snapshot(&snap);
+    if (!conflict && wait && snap.version == wait_version && timeout_ms > 0) {
+        if (timeout_ms > httpd_wait_max_ms) {
+            timeout_ms = httpd_wait_max_ms;
+        }
+        const int fd = httpd_req_to_sockfd(req);
+        // with no room to park it, answer now and let the client ask again
+        if (fd > -1 && httpd_waiters_add(fd, wait_version, timeout_ms)) {
+            return ESP_OK;
+        }
+    }
+    if (conflict) {
+        httpd_api_tag(req, snap.version);
+        httpd_resp_set_status(req, "409 Conflict");
+    } else if (httpd_api_tag(req, snap.version)) {
+        httpd_resp_set_status(req, "304 Not Modified");
+        return httpd_resp_send(req, nullptr, 0);
+    }
+    if (!httpd_api_body_update(snap)) {
+        httpd_resp_send_err(req, HTTPD_500_INTERNAL_SERVER_ERROR,
+                            "Out of memory");
+        return ESP_FAIL;
+    }
+    httpd_resp_set_type(req, "application/json");
+    return httpd_resp_send(req, httpd_api_body, httpd_api_body_len);
+}
+// /api/bits is /api for machines. the body is the alarm version as 4 bytes
+// followed by one bit per alarm, alarm 0 in the low bit of the first byte,
+// little endian throughout. POST the same layout back to set every alarm.
+// it's only applied if the version still matches, otherwise it's a 409 and
+// the current state comes back as with GET
+static constexpr const size_t httpd_bits_size = http_bits_size(alarm_count);
+static esp_err_t httpd_bits_send(httpd_req_t* req,
+                                 const alarm_snapshot& snap) {
+    uint8_t body[httpd_bits_size];
+    http_bits_encode(snap.version, snap.values, alarm_count, body);
+    httpd_resp_set_type(req, "application/octet-stream");
+    return httpd_resp_send(req, (const char*)body, sizeof(body));
+}
+static esp_err_t httpd_bits_get_handler(httpd_req_t* req) {
+    alarm_snapshot snap;
+    alarm_get_snapshot(&snap);
+    if (httpd_api_tag(req, snap.version)) {
+        httpd_resp_set_status(req, "304 Not Modified");
+        return httpd_resp_send(req, nullptr, 0);
+    }
+    return httpd_bits_send(req, snap);
+}
+// how many times a body read may time out before giving up
+static constexpr const size_t httpd_recv_retries = 3;
+// reads the whole body into <data>. a client that stalls gets a 408
+static bool httpd_recv_all(httpd_req_t* req, void* data, size_t size) {
+    size_t received = 0;
+    size_t timeouts = 0;
+    while (received < size) {
+        const int ret =
+            httpd_req_recv(req, (char*)data + received, size - received);
+        if (ret == HTTPD_SOCK_ERR_TIMEOUT) {
+            if (++timeouts == httpd_recv_retries) {
+                httpd_resp_send_408(req);
+                return false;
+            }
+            continue;
+        }
+        if (ret <= 0) {
+            return false;
+        }
+        received += ret;
+    }
+    return true;
+}
+static esp_err_t httpd_bits_post_handler(httpd_req_t* req) {
+    if (req->content_len != httpd_bits_size) {
+        httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "Bad bitmask size");
+        return ESP_FAIL;
+    }
+    uint8_t body[httpd_bits_size];
+    if (!httpd_recv_all(req, body, sizeof(body))) {
+        return ESP_FAIL;
+    }
+    uint32_t expected;
+    uint32_t values[alarm_words];
+    http_bits_decode(body, alarm_count, &expected, values);
+    const bool applied = alarm_enable_all(values, &expected);
+    if (applied) {
+        switches_refresh();
+    }
+    alarm_snapshot snap;
+    alarm_get_snapshot(&snap);
+    httpd_api_tag(req, snap.version);
+    if (!applied) {
+        httpd_resp_set_status(req, "409 Conflict");
+    }
+    return httpd_bits_send(req, snap);
+}
+static esp_err_t httpd_api_request_handler(httpd_req_t* req) {
+    const esp_err_t applied = httpd_parse_url_and_apply_alarms(req->uri);
+    if (applied == ESP_ERR_INVALID_ARG) {
+        httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "Bad alarm list");
+        return ESP_FAIL;
+    }
+    return httpd_api_handler(req, applied == ESP_ERR_INVALID_STATE);
+}
 static esp_err_t httpd_request_handler(httpd_req_t* req) {
+    const esp_err_t applied = httpd_parse_url_and_apply_alarms(req->uri);
+    if (applied == ESP_ERR_INVALID_ARG) {
+        httpd_resp_send_err(req, HTTPD_400_BAD_REQUEST, "Bad alarm list");
+        return ESP_FAIL;
+    }
     httpd_async_resp_arg* resp_arg =
         (httpd_async_resp_arg*)malloc(sizeof(httpd_async_resp_arg));
     if (resp_arg == nullptr) {
         return ESP_ERR_NO_MEM;
     }
-    httpd_parse_url_and_apply_alarms(req->uri);
     resp_arg->hd = req->handle;
     resp_arg->fd = httpd_req_to_sockfd(req);
+    http_send_buffer_init(&resp_arg->out, resp_arg->send_buffer,
+                          httpd_send_buffer_size, httpd_send_socket, resp_arg);
     if (resp_arg->fd < 0) {
+        free(resp_arg);
+        return ESP_FAIL;
+    }
+    if (ESP_OK != httpd_queue_work(req->handle, (httpd_work_fn_t)req->user_ctx,
+                                   resp_arg)) {
+        free(resp_arg);
         return ESP_FAIL;
     }
-    httpd_queue_work(req->handle, (httpd_work_fn_t)req->user_ctx, resp_arg);
     return ESP_OK;
 }
 static void httpd_init() {
-    httpd_ui_sync = xSemaphoreCreateMutex();
-    if (httpd_ui_sync == nullptr) {
-        ESP_ERROR_CHECK(ESP_ERR_NO_MEM);
+    for (size_t i = 0; i < httpd_events_max_subscribers; ++i) {
+        httpd_events_fds[i] = -1;
+    }
+    httpd_held_count = 0;
+    httpd_events_pending = false;
+    for (size_t i = 0; i < httpd_waiters_max; ++i) {
+        httpd_waiters[i].fd = -1;
+    }
+    if (httpd_waiters_timer == nullptr) {
+        esp_timer_create_args_t timer_args;
+        memset(&timer_args, 0, sizeof(timer_args));
+        timer_args.callback = httpd_waiters_timeout;
+        timer_args.dispatch_method = ESP_TIMER_TASK;
+        timer_args.name = "httpd_waiters";
+        ESP_ERROR_CHECK(esp_timer_create(&timer_args, &httpd_waiters_timer));
     }
+    httpd_etag_boot = esp_random();
     httpd_config_t config = HTTPD_DEFAULT_CONFIG();
-    config.max_uri_handlers = HTTPD_RESPONSE_HANDLER_COUNT;
+    // /api, /api/, /api/events, GET and POST /api/bits, and /api/stats
+    config.max_uri_handlers = HTTPD_RESPONSE_HANDLER_COUNT + 6;
     config.server_port = 80;
-    config.max_open_sockets = (CONFIG_LWIP_MAX_SOCKETS - 3);
+    config.max_open_sockets = httpd_max_open_sockets;
+    config.close_fn = httpd_close_handler;
+    config.core_id = io_core;
     ESP_ERROR_CHECK(httpd_start(&httpd_handle, &config));
 
     for (size_t i = 0; i < HTTPD_RESPONSE_HANDLER_COUNT; ++i) {
@@ -487,15 +1183,51 @@ static void httpd_init() {
             .user_ctx = (void*)httpd_response_handlers[i].handler};
         ESP_ERROR_CHECK(httpd_register_uri_handler(httpd_handle, &handler));
     }
+    // /api is served straight from the cached document, not a page
+    static const char* const api_uris[] = {"/api", "/api/"};
+    for (const char* uri : api_uris) {
+        printf("Registering %s\n", uri);
+        httpd_uri_t api_handler = {.uri = uri,
+                                   .method = HTTP_GET,
+                                   .handler = httpd_api_request_handler,
+                                   .user_ctx = nullptr};
+        ESP_ERROR_CHECK(httpd_register_uri_handler(httpd_handle, &api_handler));
+    }
+    puts("Registering /api/events");
+    httpd_uri_t events_handler = {.uri = "/api/events",
+                                  .method = HTTP_GET,
+                                  .handler = httpd_events_handler,
+                                  .user_ctx = nullptr};
+    ESP_ERROR_CHECK(httpd_register_uri_handler(httpd_handle, &events_handler));
+    puts("Registering /api/bits");
+    httpd_uri_t bits_get_handler = {.uri = "/api/bits",
+                                    .method = HTTP_GET,
+                                    .handler = httpd_bits_get_handler,
+                                    .user_ctx = nullptr};
+    ESP_ERROR_CHECK(
+        httpd_register_uri_handler(httpd_handle, &bits_get_handler));
+    httpd_uri_t bits_post_handler = {.uri = "/api/bits",
+                                     .method = HTTP_POST,
+                                     .handler = httpd_bits_post_handler,
+                                     .user_ctx = nullptr};
+    ESP_ERROR_CHECK(
+        httpd_register_uri_handler(httpd_handle, &bits_post_handler));
+#ifdef FRAME_STATS
+    puts("Registering /api/stats");
+    httpd_uri_t stats_handler = {.uri = "/api/stats",
+                                 .method = HTTP_GET,
+                                 .handler = httpd_stats_handler,
+                                 .user_ctx = nullptr};
+    ESP_ERROR_CHECK(httpd_register_uri_handler(httpd_handle, &stats_handler));
+#endif
 }
 static void httpd_end() {
     if (httpd_handle == nullptr) {
         return;
     }
+    esp_timer_stop(httpd_waiters_timer);
     ESP_ERROR_CHECK(httpd_stop(httpd_handle));
     httpd_handle = nullptr;
-    vSemaphoreDelete(httpd_ui_sync);
-    httpd_ui_sync = nullptr;
 }
 
 static void power_init() {
@@ -534,10 +1266,211 @@ static void spi_init() {
     spi_bus_initialize(SPI_PORT, &buscfg, SPI_DMA_CH_AUTO);
 }
 
+// the UI loop sleeps until something wakes it
+static TaskHandle_t loop_handle = nullptr;
+#ifdef CPU_USAGE_REPORT
+// flushes sent to the display. counted by the flush callback
+static uint32_t lcd_flush_count = 0;
+#endif
+#ifdef FRAME_STATS
+// histograms have power of two buckets. bucket i counts values from 2^i to
+// 2^(i+1)-1, except the first also counts zero and the last counts anything
+// bigger
+static constexpr const size_t lcd_stats_buckets = 20;
+// touch latency percentiles are taken over this many of the latest touches
+static constexpr const size_t lcd_stats_touches = 128;
+struct lcd_stats_t {
+    uint32_t buffer_size;
+    uint32_t frames;
+    uint64_t rects;
+    uint64_t bytes;
+    // time with every transfer buffer waiting on DMA, so UIX can't draw
+    uint64_t stalled_us;
+    // time of each UI loop pass that drew something
+    uint32_t frame_us[lcd_stats_buckets];
+    // rectangles flushed each frame
+    uint32_t frame_rects[lcd_stats_buckets];
+    // time from each flush to its DMA completing
+    uint32_t flush_us[lcd_stats_buckets];
+    // length of each stall
+    uint32_t stall_us[lcd_stats_buckets];
+    // time from reading a touch sample to the first pixel it drew going out
+    uint32_t touch_us[lcd_stats_buckets];
+    // the latest of those, and how many there have been
+    uint32_t touch_recent[lcd_stats_touches];
+    uint32_t touches;
+};
+static lcd_stats_t lcd_stats;
+// the DMA completion ISR updates the stats too
+static portMUX_TYPE lcd_stats_lock = portMUX_INITIALIZER_UNLOCKED;
+// flushes waiting on DMA, and when each started. they complete in order
+static size_t lcd_in_flight = 0;
+static size_t lcd_in_flight_head = 0;
+static int64_t lcd_in_flight_ts[2];
+// rectangles flushed this frame, and when the first went out. only touched
+// by the UI task
+static uint32_t lcd_frame_rects = 0;
+static uint32_t lcd_frame_first_us = 0;
+// when the touch sample UIX got this pass was read, or 0 if it got none
+static uint32_t lcd_touch_us = 0;
+static void lcd_stats_add(uint32_t* histogram, uint32_t value) {
+    size_t i = value == 0 ? 0 : 31 - __builtin_clz(value);
+    if (i >= lcd_stats_buckets) {
+        i = lcd_stats_buckets - 1;
+    }
+    ++histogram[i];
+}
+static char* lcd_stats_format_histogram(char* p, const char* name,
+                                        const uint32_t* histogram) {
+    p += sprintf(p, ",\"%s\":[", name);
+    for (size_t i = 0; i < lcd_stats_buckets; ++i) {
+        p += sprintf(p, i == 0 ? "%u" : ",%u", (unsigned)histogram[i]);
+    }
+    *p++ = ']';
+    return p;
+}
+static int lcd_stats_compare(const void* lhs, const void* rhs) {
+    const uint32_t l = *(const uint32_t*)lhs, r = *(const uint32_t*)rhs;
+    return l < r ? -1 : (l > r ? 1 : 0);
+}
+static char* lcd_stats_format(size_t* out_len) {
+    // 5 histograms of up to 11 characters a bucket, plus the totals
+    char* result = (char*)malloc(256 + (5 * lcd_stats_buckets * 11));
+    if (result == nullptr) {
+        return nullptr;
+    }
+    lcd_stats_t stats;
+    portENTER_CRITICAL(&lcd_stats_lock);
+    stats = lcd_stats;
+    portEXIT_CRITICAL(&lcd_stats_lock);
+    char* p = result;
+    p += sprintf(p,
+                 "{\"buffer_size\":%u,\"frames\":%u,\"rects\":%llu,"
+                 "\"bytes\":%llu,\"stalled_us\":%llu",
+                 (unsigned)stats.buffer_size, (unsigned)stats.frames,
+                 (unsigned long long)stats.rects,
+                 (unsigned long long)stats.bytes,
+                 (unsigned long long)stats.stalled_us);
+    // and the frames sent to the slave
+    p += sprintf(p, ",\"serial_frames\":%u,\"serial_coalesced\":%u",
+                 (unsigned)serial_tx_sent, (unsigned)serial_tx_coalesced);
+    p = lcd_stats_format_histogram(p, "frame_us", stats.frame_us);
+    p = lcd_stats_format_histogram(p, "frame_rects", stats.frame_rects);
+    p = lcd_stats_format_histogram(p, "flush_us", stats.flush_us);
+    p = lcd_stats_format_histogram(p, "stall_us", stats.stall_us);
+    p = lcd_stats_format_histogram(p, "touch_us", stats.touch_us);
+    const size_t recent = stats.touches < lcd_stats_touches
+                              ? stats.touches
+                              : lcd_stats_touches;
+    uint32_t p50 = 0, p99 = 0;
+    if (recent != 0) {
+        qsort(stats.touch_recent, recent, sizeof(uint32_t),
+              lcd_stats_compare);
+        p50 = stats.touch_recent[recent / 2];
+        p99 = stats.touch_recent[recent * 99 / 100];
+    }
+    p += sprintf(p, ",\"touches\":%u,\"touch_p50_us\":%u,\"touch_p99_us\":%u",
+                 (unsigned)stats.touches, (unsigned)p50, (unsigned)p99);
+    *p++ = '}';
+    *p = '\0';
+    *out_len = p - result;
+    return result;
+}
+#endif
+#ifdef LOOP_TIMING
+// when the last wake up happened, in microseconds, or 0 if it's been drawn
+static std::atomic<uint32_t> loop_event_us;
+#endif
+static void loop_wake() {
+#ifdef LOOP_TIMING
+    uint32_t expected = 0;
+    loop_event_us.compare_exchange_strong(expected,
+                                          (uint32_t)esp_timer_get_time() | 1);
+#endif
+    if (loop_handle != nullptr) {
+        xTaskNotifyGive(loop_handle);
+    }
+}
+
+// for the touch panel
+using touch_t = ft6336<320, 280, 16>;
+// touch samples are read off the panel by the touch task and queued for UIX
+// so the render loop never waits on I2C
+struct touch_sample {
+    size_t count;
+    point16 locations[2];
+#ifdef FRAME_STATS
+    // when it was read, never 0
+    uint32_t us;
+#endif
+};
+static constexpr const size_t touch_queue_size = 8;
+static QueueHandle_t touch_queue = nullptr;
+static TaskHandle_t touch_handle = nullptr;
+// what UIX was last told
+static touch_sample touch_last;
+#ifdef TOUCH_INT
+static void IRAM_ATTR touch_isr(void* arg) {
+#ifdef LOOP_TIMING
+    uint32_t expected = 0;
+    loop_event_us.compare_exchange_strong(expected,
+                                          (uint32_t)esp_timer_get_time() | 1);
+#endif
+    BaseType_t woken = pdFALSE;
+    if (touch_handle != nullptr) {
+        vTaskNotifyGiveFromISR(touch_handle, &woken);
+    }
+    portYIELD_FROM_ISR(woken);
+}
+#endif
+// how often the panel is polled while touched, or always without TOUCH_INT
+static constexpr const TickType_t touch_poll_ticks = pdMS_TO_TICKS(20);
+static void touch_task(void* arg) {
+    touch_t& touch = *(touch_t*)arg;
+    touch_sample sample;
+    bool touching = false;
+    while (1) {
+#ifdef TOUCH_INT
+        // the panel interrupts when touched, but only polling catches the
+        // release
+        ulTaskNotifyTake(pdTRUE, touching ? touch_poll_ticks : portMAX_DELAY);
+#else
+        ulTaskNotifyTake(pdTRUE, touch_poll_ticks);
+#endif
+        touch.update();
+        // UIX supports multiple touch points.
+        // so does the FT6336 so we potentially have
+        // two values
+        sample.count = 0;
+        uint16_t x, y;
+        if (touch.xy(&x, &y)) {
+            sample.locations[0] = point16(x, y);
+            ++sample.count;
+            if (touch.xy2(&x, &y)) {
+                sample.locations[1] = point16(x, y);
+                ++sample.count;
+            }
+        }
+        if (!touching && sample.count == 0) {
+            // nothing new
+            continue;
+        }
+        touching = sample.count != 0;
+#ifdef FRAME_STATS
+        sample.us = (uint32_t)esp_timer_get_time() | 1;
+#endif
+        if (!xQueueSend(touch_queue, &sample, 0)) {
+            // UIX fell behind. keep the newest
+            touch_sample discard;
+            xQueueReceive(touch_queue, &discard, 0);
+            xQueueSend(touch_queue, &sample, 0);
+        }
+        loop_wake();
+    }
+}
 // initialize the screen using the esp panel API
 static void lcd_init() {
     // for the touch panel
-    using touch_t = ft6336<320, 280, 16>;
     static touch_t touch(esp_i2c<1, 21, 22>::instance);
 
 #ifdef LCD_DIVISOR
@@ -588,6 +1521,24 @@ static void lcd_init() {
     io_config.on_color_trans_done = [](esp_lcd_panel_io_handle_t lcd_io,
                                        esp_lcd_panel_io_event_data_t* edata,
                                        void* user_ctx) {
+#ifdef FRAME_STATS
+        const int64_t now = esp_timer_get_time();
+        portENTER_CRITICAL_ISR(&lcd_stats_lock);
+        if (lcd_in_flight > 0) {
+            if (lcd_in_flight == 2) {
+                // a buffer is free again
+                const int64_t stalled =
+                    now - lcd_in_flight_ts[(lcd_in_flight_head + 1) & 1];
+                lcd_stats.stalled_us += stalled;
+                lcd_stats_add(lcd_stats.stall_us, (uint32_t)stalled);
+            }
+            const int64_t started =
+                lcd_in_flight_ts[(lcd_in_flight_head - lcd_in_flight) & 1];
+            lcd_stats_add(lcd_stats.flush_us, (uint32_t)(now - started));
+            --lcd_in_flight;
+        }
+        portEXIT_CRITICAL_ISR(&lcd_stats_lock);
+#endif
         lcd.flush_complete();
         return true;
     };
@@ -669,35 +1620,85 @@ static void lcd_init() {
     gpio_set_level((gpio_num_t)LCD_BL, bl_on);
 #endif
     lcd.buffer_size(lcd_transfer_buffer_size);
+#ifdef FRAME_STATS
+    lcd_stats.buffer_size = lcd_transfer_buffer_size;
+#endif
     lcd.buffer1(lcd_transfer_buffer1);
     lcd.buffer2(lcd_transfer_buffer2);
     lcd.on_flush_callback(
         [](const rect16& bounds, const void* bmp, void* state) {
+#ifdef CPU_USAGE_REPORT
+            ++lcd_flush_count;
+#endif
+#ifdef LOOP_TIMING
+            const uint32_t event_us = loop_event_us.exchange(0);
+            if (event_us != 0) {
+                printf("First pixel %uus after event\n",
+                       (unsigned)((uint32_t)esp_timer_get_time() - event_us));
+            }
+#endif
             int x1 = bounds.x1, y1 = bounds.y1, x2 = bounds.x2 + 1,
                 y2 = bounds.y2 + 1;
+#ifdef FRAME_STATS
+            if (lcd_frame_rects++ == 0) {
+                lcd_frame_first_us = (uint32_t)esp_timer_get_time();
+            }
+            portENTER_CRITICAL(&lcd_stats_lock);
+            ++lcd_stats.rects;
+            lcd_stats.bytes +=
+                (x2 - x1) * (y2 - y1) * ((LCD_BIT_DEPTH + 7) / 8);
+            lcd_in_flight_ts[lcd_in_flight_head] = esp_timer_get_time();
+            lcd_in_flight_head = (lcd_in_flight_head + 1) & 1;
+            ++lcd_in_flight;
+            portEXIT_CRITICAL(&lcd_stats_lock);
+#endif
             esp_lcd_panel_draw_bitmap((esp_lcd_panel_handle_t)state, x1, y1, x2,
                                       y2, (void*)bmp);
         },
         lcd_handle);
     lcd.on_touch_callback(
         [](point16* out_locations, size_t* in_out_locations_size, void* state) {
-            touch.update();
-            // UIX supports multiple touch points.
-            // so does the FT6336 so we potentially have
-            // two values
-            *in_out_locations_size = 0;
-            uint16_t x, y;
-            if (touch.xy(&x, &y)) {
-                out_locations[0] = point16(x, y);
-                ++*in_out_locations_size;
-                if (touch.xy2(&x, &y)) {
-                    out_locations[1] = point16(x, y);
-                    ++*in_out_locations_size;
+            // one queued sample per pass. with none queued, nothing changed
+            if (xQueueReceive(touch_queue, &touch_last, 0)) {
+#ifdef FRAME_STATS
+                lcd_touch_us = touch_last.us;
+#endif
+                if (uxQueueMessagesWaiting(touch_queue) != 0) {
+                    loop_wake();
                 }
             }
+            *in_out_locations_size = touch_last.count;
+            for (size_t i = 0; i < touch_last.count; ++i) {
+                out_locations[i] = touch_last.locations[i];
+            }
         });
     touch.initialize();
     touch.rotation(0);
+    touch_last.count = 0;
+    touch_queue = xQueueCreate(touch_queue_size, sizeof(touch_sample));
+    if (touch_queue == nullptr) {
+        puts("Unable to allocate the touch queue");
+        while (1) vTaskDelay(5);
+    }
+    // above the render loop so samples are taken as they happen
+    xTaskCreatePinnedToCore(touch_task, "touch_task", 4096, &touch, 11,
+                            &touch_handle, ui_core);
+#ifdef TOUCH_INT
+    // the panel pulls this low when it has new touch data
+    gpio_config_t touch_int_config;
+    memset(&touch_int_config, 0, sizeof(touch_int_config));
+    touch_int_config.pin_bit_mask = 1ULL << TOUCH_INT;
+    touch_int_config.mode = GPIO_MODE_INPUT;
+    touch_int_config.intr_type = GPIO_INTR_NEGEDGE;
+    gpio_config(&touch_int_config);
+    const esp_err_t res = gpio_install_isr_service(0);
+    // it's fine if something else already installed it
+    if (res != ESP_OK && res != ESP_ERR_INVALID_STATE) {
+        puts("Unable to install the GPIO ISR service");
+    } else {
+        gpio_isr_handler_add((gpio_num_t)TOUCH_INT, touch_isr, nullptr);
+    }
+#endif
 }
 
 static sdmmc_card_t* sd_card = nullptr;
@@ -741,11 +1742,12 @@ static void spiffs_init() {
     }
 }
 
-using button_t = vbutton<surface_t>;
+using button_t = text_button<surface_t>;
 using switch_t = vswitch<surface_t>;
 using label_t = label<surface_t>;
 using qr_t = qrcode<surface_t>;
 using arrow_t = arrow_box<surface_t>;
+using grid_t = alarm_grid<surface_t>;
 
 static screen_t main_screen;
 static arrow_t left_button;
@@ -759,38 +1761,150 @@ static label_t switch_labels[switches_count];
 static char switch_text[switches_count][6];
 static size_t switch_index = 0;
 static bool switches_updating = false;
+static grid_t alarm_overview;
+// the alarm store version the overview last showed
+static uint32_t alarm_overview_version = 0;
 static screen_t qr_screen;
 static qr_t qr_link;
 static button_t qr_return;
 
-static void update_switches(bool lock) {
-    if (lock && httpd_ui_sync != nullptr) {
-        xSemaphoreTake(httpd_ui_sync, portMAX_DELAY);
-    }
+static void update_switches() {
+    alarm_snapshot snap;
+    alarm_get_snapshot(&snap);
     switches_updating = true;
     for (size_t i = 0; i < switches_count; ++i) {
         itoa(1 + i + switch_index, switch_text[i], 10);
         switch_labels[i].text(switch_text[i]);
-        switches[i].value(alarm_values[i + switch_index]);
+        switches[i].value(snap.value(i + switch_index));
     }
     left_button.visible(switch_index != 0);
     right_button.visible(switch_index < alarm_count - switches_count);
+    alarm_overview.page(switch_index, switches_count);
     switches_updating = false;
-    if (lock && httpd_ui_sync != nullptr) {
-        xSemaphoreGive(httpd_ui_sync);
+}
+static void update_overview() {
+    alarm_snapshot snap;
+    alarm_get_snapshot(&snap);
+    if (snap.version != alarm_overview_version) {
+        alarm_overview_version = snap.version;
+        alarm_overview.values(snap.values);
     }
 }
 
 static void loop();
+// how often the loop runs with nothing to wake it, for housekeeping
+static constexpr const TickType_t loop_idle_ticks = pdMS_TO_TICKS(1000);
+#ifdef CPU_USAGE_REPORT
+static void cpu_usage_report(uint32_t frames) {
+    static constexpr const BaseType_t cores = 2;
+    static int64_t report_ts = 0;
+    static uint32_t idle_last[cores];
+    static uint32_t frames_last = 0;
+    const int64_t now = esp_timer_get_time();
+    if (report_ts != 0 && now - report_ts < 10 * 1000 * 1000) {
+        return;
+    }
+    for (BaseType_t i = 0; i < cores; ++i) {
+        const uint32_t idle =
+            ulTaskGetRunTimeCounter(xTaskGetIdleTaskHandleForCore(i));
+        if (report_ts != 0) {
+            // the counters tick in microseconds
+            printf("Core %d: %0.2f%% busy\n", (int)i,
+                   100.f - ((idle - idle_last[i]) * 100.f / (now - report_ts)));
+        }
+        idle_last[i] = idle;
+    }
+    if (report_ts != 0) {
+        printf("UI: %0.2f frames/s\n",
+               (frames - frames_last) * 1000000.f / (now - report_ts));
+    }
+    frames_last = frames;
+    report_ts = now;
+}
+#endif
 static void loop_task(void* arg) {
-    uint32_t ts = pdTICKS_TO_MS(xTaskGetTickCount());
+#ifdef LOOP_TIMING
+    int64_t busy_us = 0;
+    int64_t report_ts = esp_timer_get_time();
+#endif
+#ifdef CPU_USAGE_REPORT
+    uint32_t frames = 0;
+#endif
+#ifdef FRAME_STATS
+    int64_t stats_report_ts = esp_timer_get_time();
+#endif
+#ifdef LOOP_SPIN
+    TickType_t spin_ticks = xTaskGetTickCount();
+#endif
     while (1) {
+#ifdef LOOP_TIMING
+        const int64_t start = esp_timer_get_time();
+#endif
+#ifdef CPU_USAGE_REPORT
+        const uint32_t flushes = lcd_flush_count;
+#endif
+#ifdef FRAME_STATS
+        const int64_t frame_start = esp_timer_get_time();
+        lcd_frame_rects = 0;
+#endif
         loop();
-        uint32_t ms = pdTICKS_TO_MS(xTaskGetTickCount());
-        if (ms > ts + 200) {
-            ms = pdTICKS_TO_MS(xTaskGetTickCount());
+#ifdef FRAME_STATS
+        // the frame time includes any wait on DMA
+        if (lcd_frame_rects != 0) {
+            const int64_t frame_end = esp_timer_get_time();
+            portENTER_CRITICAL(&lcd_stats_lock);
+            ++lcd_stats.frames;
+            lcd_stats_add(lcd_stats.frame_us,
+                          (uint32_t)(frame_end - frame_start));
+            lcd_stats_add(lcd_stats.frame_rects, lcd_frame_rects);
+            if (lcd_touch_us != 0) {
+                const uint32_t us = lcd_frame_first_us - lcd_touch_us;
+                lcd_stats_add(lcd_stats.touch_us, us);
+                lcd_stats.touch_recent[lcd_stats.touches++ %
+                                       lcd_stats_touches] = us;
+            }
+            portEXIT_CRITICAL(&lcd_stats_lock);
+        }
+        // a touch that drew nothing isn't counted
+        lcd_touch_us = 0;
+        if (frame_start - stats_report_ts >= 10 * 1000 * 1000) {
+            size_t len;
+            char* json = lcd_stats_format(&len);
+            if (json != nullptr) {
+                printf("LCD stats: %s\n", json);
+                free(json);
+            }
+            stats_report_ts = frame_start;
+        }
+#endif
+#ifdef CPU_USAGE_REPORT
+        // a pass that sent anything to the display counts as a frame
+        if (lcd_flush_count != flushes) {
+            ++frames;
+        }
+        cpu_usage_report(frames);
+#endif
+#ifdef LOOP_TIMING
+        const int64_t end = esp_timer_get_time();
+        busy_us += end - start;
+        if (end - report_ts >= 10 * 1000 * 1000) {
+            printf("UI loop busy %0.2f%% of the time\n",
+                   busy_us * 100.f / (end - report_ts));
+            busy_us = 0;
+            report_ts = end;
+        }
+#endif
+#ifdef LOOP_SPIN
+        // only give up the core for a moment every 200ms
+        const TickType_t ticks = xTaskGetTickCount();
+        if (ticks - spin_ticks > pdMS_TO_TICKS(200)) {
             vTaskDelay(5);
+            spin_ticks = xTaskGetTickCount();
         }
+#else
+        // touch input, a state change, or a timeout wakes us
+        ulTaskNotifyTake(pdTRUE, loop_idle_ticks);
+#endif
     }
 }
 extern "C" void app_main() {
@@ -801,7 +1915,6 @@ extern "C" void app_main() {
     // initialize the display
     lcd_init();
     spiffs_init();
-    memset(alarm_values, 0, sizeof(alarm_values));
     serial_init();
     bool loaded = false;
 
@@ -830,9 +1943,11 @@ extern "C" void app_main() {
     left_button.on_pressed_changed_callback([](bool pressed, void* state) {
         if (pressed) {
             if (switch_index > 0) {
-                --switch_index;
-                // we're already locking from just outside lcd.update()
-                update_switches(false);
+                // a page at a time, so thousands of alarms stay reachable
+                switch_index = switch_index > switches_count
+                                   ? switch_index - switches_count
+                                   : 0;
+                update_switches();
             }
         }
     });
@@ -849,14 +1964,17 @@ extern "C" void app_main() {
     right_button.on_pressed_changed_callback([](bool pressed, void* state) {
         if (pressed) {
             if (switch_index < alarm_count - switches_count) {
-                ++switch_index;
-                // we're already locking from just outside lcd.update()
-                update_switches(false);
+                switch_index =
+                    math::min(switch_index + switches_count,
+                              alarm_count - switches_count);
+                update_switches();
             }
         }
     });
     main_screen.register_control(right_button);
 
+    caption_font = vlw_font(caption_stream);
+    caption_font.initialize();
     srect16 sr(0, 0, main_screen.dimensions().width / 2,
                main_screen.dimensions().width / 8);
     reset_all.bounds(sr.offset(0, main_screen.dimensions().height - sr.y2 - 1)
@@ -864,15 +1982,14 @@ extern "C" void app_main() {
     reset_all.back_color(color32_t::dark_red);
     reset_all.color(color32_t::black);
     reset_all.border_color(color32_t::dark_gray);
-    reset_all.font(font_stream);
-    reset_all.font_size(sr.height() - 4);
+    reset_all.text_font(caption_font);
     reset_all.text("Reset all");
     reset_all.radiuses({5, 5});
     reset_all.on_pressed_changed_callback([](bool pressed, void* state) {
         if (pressed) {
-            for (size_t i = 0; i < alarm_count; ++i) {
-                alarm_enable(i, false);
-            }
+            uint32_t values[alarm_words];
+            memset(values, 0, sizeof(values));
+            alarm_enable_all(values);
             switches_updating = true;
             for (size_t i = 0; i < switches_count; ++i) {
                 switches[i].value(false);
@@ -886,8 +2003,7 @@ extern "C" void app_main() {
     web_link.back_color(color32_t::light_blue);
     web_link.color(color32_t::dark_blue);
     web_link.border_color(color32_t::dark_gray);
-    web_link.font(font_stream);
-    web_link.font_size(sr.height() - 4);
+    web_link.text_font(caption_font);
     web_link.text("QR Link");
     web_link.radiuses({5, 5});
     web_link.on_pressed_changed_callback([](bool pressed, void* state) {
@@ -898,8 +2014,9 @@ extern "C" void app_main() {
     web_link.visible(false);
     main_screen.register_control(web_link);
 
-    text_font = tt_font(font_stream, main_screen.dimensions().height / 6,
-                        font_size_units::px);
+    // the labels are digits only, prerendered so nothing gets rasterized
+    // from outlines at runtime
+    text_font = vlw_font(digits_stream);
     text_font.initialize();
     char sz[16];
     itoa(alarm_count, sz, 10);
@@ -952,6 +2069,20 @@ extern "C" void app_main() {
         main_screen.register_control(l);
         x += swidth + 2;
     }
+    // the overview fills the space between the labels and the buttons
+    alarm_overview.bounds(
+        srect16(LCD_WIDTH / 53, yofs + sr.height() + area.height + 4,
+                main_screen.dimensions().width - LCD_WIDTH / 53 - 1,
+                reset_all.bounds().y1 - 4));
+    alarm_overview.count(alarm_count);
+    alarm_overview.page(switch_index, switches_count);
+    alarm_overview.on_selected_callback([](size_t alarm, void* state) {
+        // jump to the page holding that alarm
+        switch_index = math::min((alarm / switches_count) * switches_count,
+                                 alarm_count - switches_count);
+        update_switches();
+    });
+    main_screen.register_control(alarm_overview);
     // initialize the QR screen
     qr_screen.dimensions(main_screen.dimensions());
     // initialize the controls
@@ -968,8 +2099,7 @@ extern "C" void app_main() {
     qr_return.back_color(color32_t::gray);
     qr_return.color(color32_t::white);
     qr_return.border_color(color32_t::dark_gray);
-    qr_return.font(font_stream);
-    qr_return.font_size(sr.height() - 4);
+    qr_return.text_font(caption_font);
     qr_return.text("Main screen");
     qr_return.radiuses({5, 5});
     qr_return.on_pressed_changed_callback([](bool pressed, void* state) {
@@ -980,30 +2110,19 @@ extern "C" void app_main() {
     qr_screen.register_control(qr_return);
     // set the display to our main screen
     lcd.active_screen(main_screen);
-    TaskHandle_t loop_handle;
-    xTaskCreate(loop_task, "loop_task", 4096, nullptr, 10, &loop_handle);
+    xTaskCreatePinnedToCore(loop_task, "loop_task", 4096, nullptr, 10,
+                            &loop_handle, ui_core);
     printf("Free SRAM: %0.2fKB\n", esp_get_free_internal_heap_size() / 1024.f);
 }
 static void loop() {
-    // update the display and touch device
-    if (httpd_ui_sync != nullptr) {
-        xSemaphoreTake(httpd_ui_sync, portMAX_DELAY);
+    // pick up changes from the web and serial sides
+    if (switches_dirty.exchange(false)) {
+        update_switches();
     }
+    // the overview follows changes made from this screen too
+    update_overview();
+    // update the display and touch device
     lcd.update();
-    if (httpd_ui_sync != nullptr) {
-        xSemaphoreGive(httpd_ui_sync);
-    }
-    serial_event evt;
-    if (serial_get_event(&evt)) {
-        switch (evt.cmd) {
-            case ALARM_THROWN:
-                alarm_enable(evt.arg, true);
-                break;
-            default:
-                puts("Unknown event received");
-                break;
-        }
-    }
     if (!web_link.visible()) {  // not connected yet
         if (wifi_status() == WIFI_CONNECTED) {
             puts("Connected");
@@ -29,6 +29,8 @@
 #define OPENSANS_REGULAR_IMPLEMENTATION
 #include "assets/OpenSans_Regular.h"  // our font
 #include "config.h"                   // fire alarm config
+#include "alarm_protocol.h"           // commands for the slave link
+#include "serial_frame.h"             // framing for the slave link
 
 // namespace imports
 using namespace arduino;  // devices
@@ -107,6 +109,10 @@ static screen_t qr_screen;
 static qr_t qr_link;
 static button_t qr_return;
 
+static serial_frame_decoder serial_decoder;
+// the protocol version both sides speak. 1 until the slave says otherwise
+static uint8_t serial_peer_version = 1;
+
 // tell UIX the DMA transfer is complete
 static bool lcd_flush_ready(esp_lcd_panel_io_handle_t lcd_io,
                             esp_lcd_panel_io_event_data_t* edata,
@@ -362,15 +368,27 @@ static void httpd_init() {
 }
 #endif
 
+static void serial_write_frame(const uint8_t* payload, size_t size) {
+    uint8_t frame[serial_frame_max_size];
+    const size_t frame_size = serial_frame_encode(payload, size, frame);
+    Serial2.write(frame, frame_size);
+    Serial2.flush(true);
+}
+static void serial_write_hello(bool request) {
+    uint8_t payload[3];
+    serial_write_frame(payload, alarm_protocol_write_hello(request, payload));
+}
 static void switches_on_value_changed(bool value, void* state) {
     switch_t* psw = (switch_t*)state;
     const size_t index = (size_t)(psw - switches);
     printf("switch %d %s\n", (int)index, value ? "on" : "off");
-    uint8_t payload[2];
-    payload[0] = value ? SET_ALARM : CLEAR_ALARM;
-    payload[1] = index;
-    Serial2.write((const char*)payload, sizeof(payload));
-    Serial2.flush(true);
+    uint8_t payload[3];
+    const size_t size = alarm_protocol_write_alarm(
+        index, value, serial_peer_version >= 2, payload);
+    // a version 1 slave can't be told about the ones past 256
+    if (size) {
+        serial_write_frame(payload, size);
+    }
 }
 void setup() {
     Serial.begin(115200);
@@ -567,17 +585,30 @@ void setup() {
     while (Serial2.available()) {
         Serial2.read();
     }
+    serial_frame_decoder_init(&serial_decoder);
+    // find out what the slave speaks
+    serial_write_hello(true);
 }
 void loop() {
     // do we have some data?
-    if (Serial2.available() >= 2) {
-        uint8_t payload[2];
-        Serial2.readBytes(payload, 2);
-        // throw the alarm if we got a request
-        if (payload[0] == ALARM_THROWN) {
-            const size_t index = payload[1];
-            if (index < switches_count) {
-                switches[index].value(true);
+    while (Serial2.available()) {
+        const uint8_t* payload;
+        size_t size;
+        if (serial_frame_decode(&serial_decoder, Serial2.read(), &payload,
+                                &size)) {
+            alarm_protocol_command command;
+            bool request;
+            if (alarm_protocol_read_hello(payload, size, &serial_peer_version,
+                                          &request)) {
+                if (request) {
+                    serial_write_hello(false);
+                }
+            } else if (alarm_protocol_read(payload, size, &command) &&
+                       (command.id == ALARM_THROWN ||
+                        command.id == ALARM_THROWN16) &&
+                       command.first < switches_count) {
+                // throw the alarm if we got a request
+                switches[command.first].value(true);
             }
         }
     }
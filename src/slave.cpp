@@ -1,10 +1,126 @@
 #include <Arduino.h>
+#include "alarm_protocol.h"
 #include "config.h"
+#include "debounce.h"
+#include "port_scan.h"
+#include "serial_frame.h"
 
-static bool tripped[alarm_count];
-static bool last[alarm_count];
+// uncomment to print how long a scan and debounce pass takes to the USB
+// serial port. build with SCAN_DIGITALREAD too for the before numbers
+// #define SCAN_BENCHMARK
+// uncomment to scan with digitalRead() instead of the port registers
+// #define SCAN_DIGITALREAD
+
+// inputs are sampled as packed words the width of a port register
+#ifdef ESP_PLATFORM
+typedef uint32_t input_word_t;
+#else
+typedef uint8_t input_word_t;
+#endif
+static constexpr const size_t input_word_bits = sizeof(input_word_t)*8;
+static constexpr const size_t input_words = (alarm_count+input_word_bits-1)/input_word_bits;
+
+// how often the switches are sampled. a switch has to read the same for four
+// samples in a row before it counts as changed
+static constexpr const unsigned long debounce_interval_ms = 5;
+
+// the alarms the control has turned on, one bit per alarm
+static input_word_t tripped[input_words];
+// the debounced switch states, one bit per alarm
+static debounce_word<input_word_t> debounced[input_words];
+static unsigned long debounce_ts = 0;
+#ifndef SCAN_DIGITALREAD
+// the port registers the switches live on, each read once per scan
+static port_scan<input_word_t,alarm_count> switch_scan;
+#endif
+#ifdef SCAN_BENCHMARK
+// the passes timed since the last report, and their total, min and max
+static unsigned long scan_count = 0;
+static unsigned long scan_total_us = 0;
+static unsigned long scan_min_us = 0;
+static unsigned long scan_max_us = 0;
+static unsigned long scan_ts = 0;
+#endif
+static serial_frame_decoder rx_decoder;
+// the protocol version both sides speak. 1 until the control says otherwise
+static uint8_t peer_version = 1;
+
+static void set_alarm(size_t i, bool on) {
+    if(i<alarm_count) {
+        const input_word_t mask = ((input_word_t)1)<<(i%input_word_bits);
+        if(on) {
+            tripped[i/input_word_bits]|=mask;
+        } else {
+            tripped[i/input_word_bits]&=~mask;
+        }
+        digitalWrite(alarm_enable_pins[i],on?HIGH:LOW);
+    }
+}
+static void tx_command(const uint8_t* payload, size_t size);
+static void tx_hello(bool request) {
+    uint8_t payload[3];
+    tx_command(payload,alarm_protocol_write_hello(request,payload));
+}
+static void set_alarms(size_t first, size_t count, const uint8_t* values) {
+    for(size_t i = 0;i<count;++i) {
+        set_alarm(first+i,(values[i/8]>>(i%8))&1);
+    }
+}
+static void rx_command(const uint8_t* payload, size_t size) {
+    alarm_protocol_command command;
+    switch(payload[0]) {
+        case HELLO: {
+            bool request;
+            if(alarm_protocol_read_hello(payload,size,&peer_version,&request) && request) {
+                tx_hello(false);
+            }
+        } break;
+        case ALARM_THROWN:
+        case ALARM_THROWN16:
+            // only ever sent the other way
+        break;
+        default:
+            // SET_ALARM, CLEAR_ALARM and SET_ALARMS, in either width
+            if(alarm_protocol_read(payload,size,&command)) {
+                set_alarms(command.first,command.count,command.values);
+            }
+        break;
+    }
+}
+static void tx_command(const uint8_t* payload, size_t size) {
+    uint8_t frame[serial_frame_max_size];
+    const size_t frame_size = serial_frame_encode(payload,size,frame);
+    if(frame_size) {
+        Serial2.write(frame,frame_size);
+        Serial2.flush();
+    }
+}
+static void scan_init() {
+#ifndef SCAN_DIGITALREAD
+    // resolve each switch pin to a port register and mask once, up front
+    port_scan_init(&switch_scan);
+    for(size_t i = 0;i<alarm_count;++i) {
+        volatile input_word_t* port = (volatile input_word_t*)portInputRegister(digitalPinToPort(alarm_switch_pins[i]));
+        port_scan_add(&switch_scan,i,port,(input_word_t)digitalPinToBitMask(alarm_switch_pins[i]));
+    }
+#endif
+}
+// samples every switch into <out_values>, one bit per alarm
+static void scan(input_word_t* out_values) {
+#ifdef SCAN_DIGITALREAD
+    memset(out_values,0,sizeof(input_word_t)*input_words);
+    for(size_t i = 0;i<alarm_count;++i) {
+        if(digitalRead(alarm_switch_pins[i])!=LOW) {
+            out_values[i/input_word_bits]|=((input_word_t)1)<<(i%input_word_bits);
+        }
+    }
+#else
+    port_scan_read(&switch_scan,out_values);
+#endif
+}
 void setup() {
-    memset(tripped,0,sizeof(bool)*alarm_count);
+    memset(tripped,0,sizeof(tripped));
+    serial_frame_decoder_init(&rx_decoder);
 #ifdef ESP_PLATFORM
     Serial2.begin(serial_baud_rate,SERIAL_8N1,slave_serial_pins.rx,slave_serial_pins.tx);
 #else
@@ -14,36 +130,73 @@ void setup() {
         pinMode(alarm_switch_pins[i],INPUT);
         pinMode(alarm_enable_pins[i],OUTPUT);
     }
+    scan_init();
+    for(size_t w = 0;w<input_words;++w) {
+        debounce_init(&debounced[w]);
+    }
+    debounce_ts = millis();
+#ifdef SCAN_BENCHMARK
+    Serial.begin(115200);
+    scan_ts = millis();
+#endif
+    // find out what the control speaks
+    tx_hello(true);
 }
 void loop() {
-    uint8_t payload[2];
-    for(size_t i = 0;i<alarm_count;++i) {
-        const bool thrown = digitalRead(alarm_switch_pins[i])!=LOW;
-        if(thrown!=last[i]) {
-            last[i]=thrown;
-            if(thrown && !tripped[i]) {
-                payload[0]=ALARM_THROWN;
-                payload[1]=i;
-                Serial2.write(payload,sizeof(payload));
-                Serial2.flush();
+    if(millis()-debounce_ts>=debounce_interval_ms) {
+        debounce_ts+=debounce_interval_ms;
+#ifdef SCAN_BENCHMARK
+        const unsigned long scan_start = micros();
+#endif
+        input_word_t thrown[input_words];
+        scan(thrown);
+        for(size_t w = 0;w<input_words;++w) {
+            // only switches that settled on, and aren't already tripped
+            thrown[w] = debounce(&debounced[w],thrown[w])&debounced[w].state&~tripped[w];
+        }
+#ifdef SCAN_BENCHMARK
+        const unsigned long scan_us = micros()-scan_start;
+        if(scan_count==0 || scan_us<scan_min_us) {
+            scan_min_us = scan_us;
+        }
+        if(scan_us>scan_max_us) {
+            scan_max_us = scan_us;
+        }
+        scan_total_us+=scan_us;
+        ++scan_count;
+#endif
+        uint8_t payload[3];
+        for(size_t w = 0;w<input_words;++w) {
+            for(size_t b = 0;thrown[w]!=0;++b,thrown[w]>>=1) {
+                const size_t i = w*input_word_bits+b;
+                if(thrown[w]&1) {
+                    const size_t size = alarm_protocol_write_thrown(i,peer_version>=2,payload);
+                    if(size) {
+                        tx_command(payload,size);
+                    }
+                }
             }
         }
     }
-    if(Serial2.available()>=2) {
-        Serial2.readBytes((char*)payload,sizeof(payload));
-        switch(payload[0]) {
-            case SET_ALARM:
-                if(payload[1]<alarm_count) {    
-                    tripped[payload[1]]=true;
-                    digitalWrite(alarm_enable_pins[payload[1]],HIGH);
-                }
-            break;
-            case CLEAR_ALARM:
-                if(payload[1]<alarm_count) {
-                    tripped[payload[1]]=false;
-                    digitalWrite(alarm_enable_pins[payload[1]],LOW);
-                }
-            break;
+#ifdef SCAN_BENCHMARK
+    if(millis()-scan_ts>=1000 && scan_count>0) {
+        Serial.print("scan+debounce us min/avg/max: ");
+        Serial.print(scan_min_us);
+        Serial.print('/');
+        Serial.print(scan_total_us/scan_count);
+        Serial.print('/');
+        Serial.println(scan_max_us);
+        scan_count = 0;
+        scan_total_us = 0;
+        scan_max_us = 0;
+        scan_ts = millis();
+    }
+#endif
+    while(Serial2.available()>0) {
+        const uint8_t* rx_payload;
+        size_t rx_size;
+        if(serial_frame_decode(&rx_decoder,Serial2.read(),&rx_payload,&rx_size)) {
+            rx_command(rx_payload,rx_size);
         }
     }
 }
\ No newline at end of file
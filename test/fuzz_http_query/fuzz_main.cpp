@@ -0,0 +1,126 @@
+// libFuzzer target for the query tokenizer in include/http_query.h. it's
+// not a unity suite, so pio test leaves it alone. build and run with clang:
+//
+//   clang++ -std=gnu++17 -g -O1 -fsanitize=fuzzer,address,undefined \
+//       -Iinclude test/fuzz_http_query/fuzz_main.cpp -o fuzz_http_query
+//   ./fuzz_http_query -max_len=1024 -dict=test/fuzz_http_query/query.dict
+//
+// compilers without libFuzzer can build it with -DFUZZ_STANDALONE, which
+// adds a main() that feeds it random queries, or the files named on the
+// command line
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "http_query.h"
+
+// every view must lie inside the query
+static void check_part(const char* begin, const char* end,
+                       http_query_part part) {
+    if (part.begin < begin || part.begin + part.size > end) {
+        abort();
+    }
+}
+// decoding never reads more than is there, and always makes progress
+static void check_decode(http_query_part part) {
+    size_t steps = 0;
+    while (http_query_getc(&part) != -1) {
+        if (++steps > 1024 * 1024) {
+            abort();
+        }
+    }
+}
+// a number only comes back if the part is all digits, and it's the same
+// number strtoul gets from the decoded text
+static void check_uint(http_query_part part) {
+    uint32_t value;
+    if (!http_query_uint(part, &value)) {
+        return;
+    }
+    char decoded[32];
+    size_t size = 0;
+    int ch;
+    while ((ch = http_query_getc(&part)) != -1) {
+        if (ch < '0' || ch > '9' || size == sizeof(decoded) - 1) {
+            abort();
+        }
+        decoded[size++] = (char)ch;
+    }
+    decoded[size] = '\0';
+    if (strtoul(decoded, nullptr, 10) != value) {
+        abort();
+    }
+}
+static void check_ranges(http_query_part list) {
+    uint32_t first, last;
+    bool error;
+    size_t size = list.size;
+    while (http_query_next_range(&list, &first, &last, &error)) {
+        if (first > last || error || list.size >= size) {
+            abort();
+        }
+        size = list.size;
+    }
+}
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t* data, size_t size) {
+    // the tokenizer works on the NUL terminated URI httpd hands us
+    char* query = (char*)malloc(size + 1);
+    if (query == nullptr) {
+        return 0;
+    }
+    memcpy(query, data, size);
+    query[size] = '\0';
+    const char* end = query + strlen(query);
+    const char* p = query;
+    http_query_param param;
+    size_t params = 0;
+    while ((p = http_query_next(p, &param)) != nullptr) {
+        if (p > end || ++params > size) {
+            abort();
+        }
+        check_part(query, end, param.name);
+        check_part(query, end, param.value);
+        check_decode(param.name);
+        check_decode(param.value);
+        check_uint(param.value);
+        check_ranges(param.value);
+        http_query_equals(param.name, "set");
+    }
+    free(query);
+    return 0;
+}
+
+#ifdef FUZZ_STANDALONE
+// queries are mostly made of these, so random ones say something
+static const char fuzz_alphabet[] = "?&=#%+,-0123456789aAfFnost";
+int main(int argc, char** argv) {
+    if (argc > 1) {
+        for (int i = 1; i < argc; ++i) {
+            FILE* f = fopen(argv[i], "rb");
+            if (f == nullptr) {
+                perror(argv[i]);
+                return 1;
+            }
+            static uint8_t data[64 * 1024];
+            const size_t size = fread(data, 1, sizeof(data), f);
+            fclose(f);
+            LLVMFuzzerTestOneInput(data, size);
+        }
+        return 0;
+    }
+    srand(1);
+    uint8_t data[256];
+    for (int i = 0; i < 1000000; ++i) {
+        const size_t size = rand() % sizeof(data);
+        for (size_t j = 0; j < size; ++j) {
+            const size_t k = rand() % (sizeof(fuzz_alphabet) - 1);
+            // now and then a byte from anywhere, NUL included
+            data[j] = (rand() % 16) ? fuzz_alphabet[k] : (uint8_t)rand();
+        }
+        LLVMFuzzerTestOneInput(data, size);
+    }
+    puts("1000000 random queries");
+    return 0;
+}
+#endif
@@ -0,0 +1,257 @@
+#include <unity.h>
+#include <stdio.h>
+#include <string.h>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include "alarm_bits.h"
+
+// deliberately not a multiple of 32, so the last word is partial
+static constexpr const size_t alarm_count = 1000;
+using store_t = alarm_bits<alarm_count, std::mutex>;
+static constexpr const size_t words = store_t::words;
+
+void setUp(void) {}
+void tearDown(void) {}
+
+static void test_set(void) {
+    store_t store;
+    store_t::snapshot snap;
+    store.get_snapshot(&snap);
+    TEST_ASSERT_EQUAL_UINT32(0, snap.version);
+    TEST_ASSERT_TRUE(store.set(37, true));
+    // no change, no new version
+    TEST_ASSERT_FALSE(store.set(37, true));
+    TEST_ASSERT_FALSE(store.set(alarm_count, true));
+    store.get_snapshot(&snap);
+    TEST_ASSERT_EQUAL_UINT32(1, snap.version);
+    TEST_ASSERT_TRUE(snap.value(37));
+    TEST_ASSERT_EQUAL_HEX32(1 << 5, snap.values[1]);
+    TEST_ASSERT_TRUE(store.set(37, false));
+    store.get_snapshot(&snap);
+    TEST_ASSERT_EQUAL_UINT32(2, snap.version);
+    TEST_ASSERT_EQUAL_HEX32(0, snap.values[1]);
+}
+static void test_set_all(void) {
+    store_t store;
+    store_t::snapshot snap;
+    uint32_t values[words];
+    uint32_t changed[words] = {};
+    memset(values, 0xFF, sizeof(values));
+    TEST_ASSERT_TRUE(store.set_all(values, nullptr, changed));
+    store.get_snapshot(&snap);
+    TEST_ASSERT_EQUAL_UINT32(1, snap.version);
+    // the bits past the last alarm stay clear
+    TEST_ASSERT_EQUAL_HEX32((1 << (alarm_count % 32)) - 1,
+                            snap.values[words - 1]);
+    TEST_ASSERT_EQUAL_HEX32(snap.values[words - 1], changed[words - 1]);
+    TEST_ASSERT_EQUAL_HEX32(UINT32_MAX, changed[0]);
+    // a stale version changes nothing
+    uint32_t stale = 0;
+    memset(values, 0, sizeof(values));
+    memset(changed, 0, sizeof(changed));
+    TEST_ASSERT_FALSE(store.set_all(values, &stale, changed));
+    store.get_snapshot(&snap);
+    TEST_ASSERT_EQUAL_UINT32(1, snap.version);
+    TEST_ASSERT_TRUE(snap.value(0));
+    for (size_t i = 0; i < words; ++i) {
+        TEST_ASSERT_EQUAL_HEX32(0, changed[i]);
+    }
+    // the current one does
+    uint32_t current = 1;
+    values[3] = 0xFFFF0000;
+    TEST_ASSERT_TRUE(store.set_all(values, &current, changed));
+    store.get_snapshot(&snap);
+    TEST_ASSERT_EQUAL_UINT32(2, snap.version);
+    TEST_ASSERT_EQUAL_HEX32(0x0000FFFF, changed[3]);
+    TEST_ASSERT_EQUAL_HEX32(0xFFFF0000, snap.values[3]);
+}
+static void test_set_ranges(void) {
+    store_t store;
+    store_t::snapshot snap;
+    uint32_t changed[words] = {};
+    const alarm_range ranges[] = {{30, 97, true},
+                                  {64, 64, false},
+                                  {alarm_count - 1, alarm_count - 1, true}};
+    TEST_ASSERT_TRUE(store.set_ranges(ranges, 3, nullptr, changed));
+    store.get_snapshot(&snap);
+    TEST_ASSERT_EQUAL_UINT32(1, snap.version);
+    for (size_t i = 0; i < alarm_count; ++i) {
+        const bool on = (i >= 30 && i <= 97 && i != 64) || i == alarm_count - 1;
+        TEST_ASSERT_EQUAL_INT(on, snap.value(i));
+    }
+    // only the words the ranges cover were touched. 64 was switched on and
+    // back off, which still counts
+    TEST_ASSERT_EQUAL_HEX32(0xC0000000, changed[0]);
+    TEST_ASSERT_EQUAL_HEX32(UINT32_MAX, changed[1]);
+    TEST_ASSERT_EQUAL_HEX32(UINT32_MAX, changed[2]);
+    TEST_ASSERT_EQUAL_HEX32(0x00000003, changed[3]);
+    TEST_ASSERT_EQUAL_HEX32(0, changed[4]);
+    // setting what's already set isn't a change
+    memset(changed, 0, sizeof(changed));
+    TEST_ASSERT_TRUE(store.set_ranges(ranges, 1, nullptr, changed));
+    store.get_snapshot(&snap);
+    TEST_ASSERT_EQUAL_UINT32(2, snap.version);
+    TEST_ASSERT_EQUAL_HEX32(1, changed[2]);
+    uint32_t stale = 1;
+    TEST_ASSERT_FALSE(store.set_ranges(ranges + 1, 1, &stale, changed));
+}
+static void test_apply(void) {
+    store_t store;
+    store_t::snapshot snap;
+    uint32_t values[words];
+    uint32_t changed[words] = {};
+    memset(values, 0, sizeof(values));
+    values[0] = 0x0000000F;
+    const alarm_range ranges[] = {{2, 40, true}, {3, 3, false}};
+    TEST_ASSERT_TRUE(store.apply(values, ranges, 2, nullptr, changed));
+    store.get_snapshot(&snap);
+    // one write, one version
+    TEST_ASSERT_EQUAL_UINT32(1, snap.version);
+    for (size_t i = 0; i < alarm_count; ++i) {
+        const bool on = i <= 40 && i != 3;
+        TEST_ASSERT_EQUAL_INT(on, snap.value(i));
+    }
+    // 3 was set and then cleared again, so it didn't change
+    TEST_ASSERT_EQUAL_HEX32(0xFFFFFFF7, changed[0]);
+    TEST_ASSERT_EQUAL_HEX32(0x000001FF, changed[1]);
+    // the version is checked once, before any of it
+    memset(changed, 0, sizeof(changed));
+    uint32_t stale = 0;
+    memset(values, 0, sizeof(values));
+    TEST_ASSERT_FALSE(store.apply(values, ranges, 2, &stale, changed));
+    store.get_snapshot(&snap);
+    TEST_ASSERT_EQUAL_UINT32(1, snap.version);
+    TEST_ASSERT_TRUE(snap.value(40));
+    TEST_ASSERT_EQUAL_HEX32(0, changed[0]);
+    // the same state again isn't a change
+    values[0] = 0x0000000F;
+    uint32_t current = 1;
+    TEST_ASSERT_TRUE(store.apply(values, ranges, 2, &current, changed));
+    store.get_snapshot(&snap);
+    TEST_ASSERT_EQUAL_UINT32(1, snap.version);
+    // without values it's set_ranges()
+    TEST_ASSERT_TRUE(store.apply(nullptr, ranges + 1, 1, &current, changed));
+    store.get_snapshot(&snap);
+    TEST_ASSERT_EQUAL_UINT32(1, snap.version);
+    const alarm_range off = {0, alarm_count - 1, false};
+    TEST_ASSERT_TRUE(store.apply(nullptr, &off, 1, &current, changed));
+    store.get_snapshot(&snap);
+    TEST_ASSERT_EQUAL_UINT32(2, snap.version);
+    TEST_ASSERT_EQUAL_HEX32(0, snap.values[0]);
+}
+// every word the writer publishes holds the version it's publishing, so a
+// torn snapshot shows up as words that disagree with each other
+static void test_concurrent_readers(void) {
+    store_t store;
+    static constexpr const uint32_t writes = 200000;
+    static constexpr const size_t reader_count = 3;
+    std::atomic_bool done(false);
+    std::atomic<uint32_t> torn(0);
+    std::atomic<uint32_t> backwards(0);
+    std::atomic<size_t> reads(0);
+    std::thread readers[reader_count];
+    for (size_t r = 0; r < reader_count; ++r) {
+        readers[r] = std::thread([&]() {
+            store_t::snapshot snap;
+            uint32_t last_version = 0;
+            size_t count = 0;
+            while (!done) {
+                store.get_snapshot(&snap);
+                for (size_t i = 0; i < words - 1; ++i) {
+                    if (snap.values[i] != snap.version) {
+                        ++torn;
+                        break;
+                    }
+                }
+                if (snap.version < last_version) {
+                    ++backwards;
+                }
+                last_version = snap.version;
+                ++count;
+            }
+            reads += count;
+        });
+    }
+    uint32_t values[words];
+    uint32_t changed[words];
+    for (uint32_t v = 1; v <= writes; ++v) {
+        for (size_t i = 0; i < words; ++i) {
+            values[i] = v;
+        }
+        TEST_ASSERT_TRUE(store.set_all(values, nullptr, changed));
+    }
+    done = true;
+    for (std::thread& reader : readers) {
+        reader.join();
+    }
+    TEST_ASSERT_EQUAL_UINT32(0, torn.load());
+    TEST_ASSERT_EQUAL_UINT32(0, backwards.load());
+    store_t::snapshot snap;
+    store.get_snapshot(&snap);
+    TEST_ASSERT_EQUAL_UINT32(writes, snap.version);
+    char msg[96];
+    snprintf(msg, sizeof(msg), "%u writes against %u snapshots",
+             (unsigned)writes, (unsigned)reads.load());
+    TEST_MESSAGE(msg);
+}
+static double ns_per(std::chrono::steady_clock::time_point start,
+                     size_t iterations) {
+    return std::chrono::duration<double, std::nano>(
+               std::chrono::steady_clock::now() - start)
+               .count() /
+           iterations;
+}
+static void test_benchmark(void) {
+    static constexpr const size_t iterations = 1000000;
+    store_t store;
+    store_t::snapshot snap;
+    uint32_t sink = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < iterations; ++i) {
+        store.get_snapshot(&snap);
+        sink += snap.values[i % words];
+    }
+    const double snapshot_ns = ns_per(start, iterations);
+    start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < iterations; ++i) {
+        sink += store.set(i % alarm_count, i & 1);
+    }
+    const double set_ns = ns_per(start, iterations);
+    // and snapshots again while another thread keeps writing
+    std::atomic_bool done(false);
+    std::thread writer([&]() {
+        size_t i = 0;
+        while (!done) {
+            store.set(i % alarm_count, (i / alarm_count) & 1);
+            ++i;
+        }
+    });
+    start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < iterations; ++i) {
+        store.get_snapshot(&snap);
+        sink += snap.values[i % words];
+    }
+    const double contended_ns = ns_per(start, iterations);
+    done = true;
+    writer.join();
+    char msg[160];
+    snprintf(msg, sizeof(msg),
+             "%u alarms: snapshot %.1fns, %.1fns under writes, set %.1fns "
+             "(%u)",
+             (unsigned)alarm_count, snapshot_ns, contended_ns, set_ns,
+             (unsigned)(sink & 1));
+    TEST_MESSAGE(msg);
+}
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_set);
+    RUN_TEST(test_set_all);
+    RUN_TEST(test_set_ranges);
+    RUN_TEST(test_apply);
+    RUN_TEST(test_concurrent_readers);
+    RUN_TEST(test_benchmark);
+    return UNITY_END();
+}
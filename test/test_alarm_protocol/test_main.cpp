@@ -0,0 +1,336 @@
+#include <unity.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <mutex>
+#include "alarm_bits.h"
+#include "alarm_protocol.h"
+
+// an installation far bigger than the 8-bit ids can address
+static constexpr const size_t sim_alarm_count = 4096;
+using store_t = alarm_bits<sim_alarm_count, std::mutex>;
+static constexpr const size_t words = store_t::words;
+
+// the slave's end of the link: a frame decoder and the enable outputs
+struct sim_slave {
+    serial_frame_decoder decoder;
+    bool enabled[sim_alarm_count];
+    size_t frames;
+    void init() {
+        serial_frame_decoder_init(&decoder);
+        memset(enabled, 0, sizeof(enabled));
+        frames = 0;
+    }
+    void receive(const uint8_t* frame, size_t size) {
+        for (size_t i = 0; i < size; ++i) {
+            const uint8_t* payload;
+            size_t payload_size;
+            alarm_protocol_command command;
+            if (serial_frame_decode(&decoder, frame[i], &payload,
+                                    &payload_size) &&
+                alarm_protocol_read(payload, payload_size, &command)) {
+                ++frames;
+                for (size_t j = 0; j < command.count; ++j) {
+                    if (command.first + j < sim_alarm_count) {
+                        enabled[command.first + j] =
+                            (command.values[j / 8] >> (j % 8)) & 1;
+                    }
+                }
+            }
+        }
+    }
+};
+static store_t* store;
+static sim_slave slave;
+// bytes sent down the link
+static size_t wire_bytes;
+
+void setUp(void) {
+    srand(1);
+    store = new store_t();
+    slave.init();
+    wire_bytes = 0;
+}
+void tearDown(void) { delete store; }
+
+static void send_payload(const uint8_t* payload, size_t size) {
+    uint8_t frame[serial_frame_max_size];
+    const size_t frame_size = serial_frame_encode(payload, size, frame);
+    TEST_ASSERT_GREATER_THAN(0, frame_size);
+    wire_bytes += frame_size;
+    slave.receive(frame, frame_size);
+}
+static size_t send_alarms(const uint32_t* values, size_t first,
+                          size_t count, bool wide) {
+    uint8_t payload[alarm_protocol_max_payload];
+    size_t frames = 0;
+    while (count) {
+        size_t n;
+        const size_t size = alarm_protocol_write_alarms(values, first, count,
+                                                        wide, payload, &n);
+        if (size == 0) {
+            break;
+        }
+        TEST_ASSERT_LESS_OR_EQUAL(alarm_protocol_max_payload, size);
+        send_payload(payload, size);
+        ++frames;
+        first += n;
+        count -= n;
+    }
+    return frames;
+}
+// sends what changed the way the control does, run by run, each as single
+// alarm frames or masks, whichever is smaller. returns the frames sent
+static size_t send_changed(const uint32_t* changed, bool wide) {
+    store_t::snapshot snap;
+    store->get_snapshot(&snap);
+    size_t frames = 0;
+    alarm_protocol_run run;
+    size_t start = 0;
+    while (alarm_protocol_next_run(changed, sim_alarm_count, start, wide,
+                                   &run)) {
+        const size_t before = frames;
+        if (run.mask) {
+            frames += send_alarms(snap.values, run.first,
+                                  run.last - run.first + 1, wide);
+        } else {
+            uint8_t payload[3];
+            for (size_t i = run.first; i <= run.last; ++i) {
+                if ((changed[i / 32] >> (i % 32)) & 1) {
+                    const size_t size = alarm_protocol_write_alarm(
+                        i, snap.value(i), wide, payload);
+                    TEST_ASSERT_GREATER_THAN(0, size);
+                    send_payload(payload, size);
+                    ++frames;
+                }
+            }
+        }
+        TEST_ASSERT_EQUAL_size_t(run.frames, frames - before);
+        TEST_ASSERT_TRUE(run.last >= start);
+        start = run.last + 1;
+    }
+    return frames;
+}
+// the slave has every alarm below <limit> the way the control does
+static void check_slave(size_t limit) {
+    store_t::snapshot snap;
+    store->get_snapshot(&snap);
+    for (size_t i = 0; i < sim_alarm_count; ++i) {
+        const bool expected = i < limit ? snap.value(i) : false;
+        if (slave.enabled[i] != expected) {
+            char msg[64];
+            snprintf(msg, sizeof(msg), "alarm %u", (unsigned)i);
+            TEST_FAIL_MESSAGE(msg);
+        }
+    }
+}
+static void random_changes(bool wide, size_t limit) {
+    for (int pass = 0; pass < 300; ++pass) {
+        uint32_t changed[words] = {};
+        switch (rand() % 3) {
+            case 0: {
+                // a single alarm, as from the switches
+                const uint16_t alarm = rand() % sim_alarm_count;
+                const alarm_range r = {alarm, alarm, (rand() & 1) != 0};
+                store->set_ranges(&r, 1, nullptr, changed);
+            } break;
+            case 1: {
+                uint32_t values[words];
+                for (size_t i = 0; i < words; ++i) {
+                    values[i] = (uint32_t)rand() ^ ((uint32_t)rand() << 16);
+                }
+                store->set_all(values, nullptr, changed);
+            } break;
+            default: {
+                alarm_range ranges[4];
+                for (alarm_range& r : ranges) {
+                    r.first = rand() % sim_alarm_count;
+                    r.last = r.first + rand() % (sim_alarm_count - r.first);
+                    r.on = rand() & 1;
+                }
+                store->set_ranges(ranges, 4, nullptr, changed);
+            } break;
+        }
+        // never more frames than sending each change on its own
+        size_t changes = 0;
+        for (size_t i = 0; i < (wide ? words : 256 / 32); ++i) {
+            changes += __builtin_popcount(changed[i]);
+        }
+        TEST_ASSERT_LESS_OR_EQUAL(changes, send_changed(changed, wide));
+        check_slave(limit);
+    }
+}
+static void test_wide(void) {
+    random_changes(true, sim_alarm_count);
+    // all of them in one go takes ceil(4096 / 248) frames
+    uint32_t values[words];
+    memset(values, 0xFF, sizeof(values));
+    uint32_t changed[words] = {};
+    store->set_all(values, nullptr, changed);
+    memset(changed, 0xFF, sizeof(changed));
+    const size_t frames = slave.frames;
+    send_changed(changed, true);
+    check_slave(sim_alarm_count);
+    TEST_ASSERT_EQUAL_size_t(
+        (sim_alarm_count + set_alarms_max_count - 1) / set_alarms_max_count,
+        slave.frames - frames);
+}
+static void test_version1_peer(void) {
+    // an old slave only ever hears about the first 256
+    random_changes(false, 256);
+}
+static void test_single_ids(void) {
+    static const size_t ids[] = {0, 255, 256, 257, 1000, 4095};
+    uint8_t payload[alarm_protocol_max_payload];
+    for (size_t id : ids) {
+        for (int on = 1; on >= 0; --on) {
+            size_t size = alarm_protocol_write_alarm(id, on, true, payload);
+            TEST_ASSERT_EQUAL_size_t(3, size);
+            send_payload(payload, size);
+            TEST_ASSERT_EQUAL_INT(on, slave.enabled[id]);
+            size = alarm_protocol_write_alarm(id, on, false, payload);
+            TEST_ASSERT_EQUAL_size_t(id < 256 ? 2 : 0, size);
+        }
+    }
+}
+static void test_thrown(void) {
+    // from the slave back to the control, for every alarm
+    uint8_t payload[alarm_protocol_max_payload];
+    for (size_t id = 0; id < sim_alarm_count; ++id) {
+        alarm_protocol_command command;
+        size_t size = alarm_protocol_write_thrown(id, true, payload);
+        TEST_ASSERT_TRUE(alarm_protocol_read(payload, size, &command));
+        TEST_ASSERT_EQUAL_UINT8(ALARM_THROWN16, command.id);
+        TEST_ASSERT_EQUAL_size_t(id, command.first);
+        size = alarm_protocol_write_thrown(id, false, payload);
+        if (id < 256) {
+            TEST_ASSERT_TRUE(alarm_protocol_read(payload, size, &command));
+            TEST_ASSERT_EQUAL_UINT8(ALARM_THROWN, command.id);
+            TEST_ASSERT_EQUAL_size_t(id, command.first);
+        } else {
+            TEST_ASSERT_EQUAL_size_t(0, size);
+        }
+    }
+}
+static void mark(uint32_t* changed, size_t alarm) {
+    changed[alarm / 32] |= UINT32_C(1) << (alarm % 32);
+}
+static void test_runs(void) {
+    alarm_protocol_run run;
+    uint32_t changed[words] = {};
+    TEST_ASSERT_FALSE(
+        alarm_protocol_next_run(changed, sim_alarm_count, 0, true, &run));
+    // far apart, they go as separate single alarm frames
+    mark(changed, 5);
+    mark(changed, 2000);
+    TEST_ASSERT_TRUE(
+        alarm_protocol_next_run(changed, sim_alarm_count, 0, true, &run));
+    TEST_ASSERT_EQUAL_size_t(5, run.first);
+    TEST_ASSERT_EQUAL_size_t(5, run.last);
+    TEST_ASSERT_FALSE(run.mask);
+    TEST_ASSERT_EQUAL_size_t(1, run.frames);
+    TEST_ASSERT_TRUE(
+        alarm_protocol_next_run(changed, sim_alarm_count, 6, true, &run));
+    TEST_ASSERT_EQUAL_size_t(2000, run.first);
+    TEST_ASSERT_FALSE(
+        alarm_protocol_next_run(changed, sim_alarm_count, 2001, true, &run));
+    // a 64 alarm gap costs as much as another mask frame, so it splits
+    memset(changed, 0, sizeof(changed));
+    mark(changed, 100);
+    mark(changed, 164);
+    alarm_protocol_next_run(changed, sim_alarm_count, 0, true, &run);
+    TEST_ASSERT_EQUAL_size_t(164, run.last);
+    mark(changed, 229);
+    alarm_protocol_next_run(changed, sim_alarm_count, 0, true, &run);
+    TEST_ASSERT_EQUAL_size_t(164, run.last);
+    TEST_ASSERT_EQUAL_size_t(2, run.changed);
+    // close together, a mask is cheaper
+    memset(changed, 0, sizeof(changed));
+    mark(changed, 10);
+    mark(changed, 12);
+    mark(changed, 14);
+    alarm_protocol_next_run(changed, sim_alarm_count, 0, true, &run);
+    TEST_ASSERT_TRUE(run.mask);
+    TEST_ASSERT_EQUAL_size_t(3, run.changed);
+    TEST_ASSERT_EQUAL_size_t(1, run.frames);
+    // joined up but sparse and long, singles are cheaper
+    memset(changed, 0, sizeof(changed));
+    for (size_t i = 0; i < 8; ++i) {
+        mark(changed, 1000 + i * 40);
+    }
+    alarm_protocol_next_run(changed, sim_alarm_count, 0, true, &run);
+    TEST_ASSERT_EQUAL_size_t(1280, run.last);
+    TEST_ASSERT_FALSE(run.mask);
+    TEST_ASSERT_EQUAL_size_t(8, run.frames);
+    // and that is what goes down the wire
+    store->set(1000, true);
+    TEST_ASSERT_EQUAL_size_t(8, send_changed(changed, true));
+    TEST_ASSERT_EQUAL_size_t(8 * alarm_protocol_frame_size(3), wire_bytes);
+    check_slave(sim_alarm_count);
+    // a version 1 peer can't be sent anything past 256
+    memset(changed, 0, sizeof(changed));
+    mark(changed, 256);
+    TEST_ASSERT_FALSE(
+        alarm_protocol_next_run(changed, sim_alarm_count, 0, false, &run));
+    mark(changed, 255);
+    alarm_protocol_next_run(changed, sim_alarm_count, 0, false, &run);
+    TEST_ASSERT_EQUAL_size_t(255, run.last);
+}
+static void test_hello(void) {
+    uint8_t payload[3];
+    uint8_t version;
+    bool request;
+    TEST_ASSERT_EQUAL_size_t(3, alarm_protocol_write_hello(true, payload));
+    TEST_ASSERT_TRUE(alarm_protocol_read_hello(payload, 3, &version, &request));
+    TEST_ASSERT_EQUAL_UINT8(protocol_version, version);
+    TEST_ASSERT_TRUE(request);
+    alarm_protocol_write_hello(false, payload);
+    TEST_ASSERT_TRUE(alarm_protocol_read_hello(payload, 3, &version, &request));
+    TEST_ASSERT_FALSE(request);
+    // both sides settle on the older of the two
+    payload[1] = 1;
+    alarm_protocol_read_hello(payload, 3, &version, &request);
+    TEST_ASSERT_EQUAL_UINT8(1, version);
+    payload[1] = protocol_version + 1;
+    alarm_protocol_read_hello(payload, 3, &version, &request);
+    TEST_ASSERT_EQUAL_UINT8(protocol_version, version);
+    TEST_ASSERT_FALSE(
+        alarm_protocol_read_hello(payload, 2, &version, &request));
+    // and it isn't mistaken for an alarm command, or the other way round
+    alarm_protocol_command command;
+    TEST_ASSERT_FALSE(alarm_protocol_read(payload, 3, &command));
+    const size_t size = alarm_protocol_write_thrown(5, false, payload);
+    TEST_ASSERT_FALSE(
+        alarm_protocol_read_hello(payload, size, &version, &request));
+}
+static void test_short_payloads(void) {
+    uint32_t values[words];
+    memset(values, 0xFF, sizeof(values));
+    uint8_t payload[alarm_protocol_max_payload];
+    size_t n;
+    const size_t size =
+        alarm_protocol_write_alarms(values, 3000, 100, true, payload, &n);
+    TEST_ASSERT_EQUAL_size_t(100, n);
+    alarm_protocol_command command;
+    TEST_ASSERT_TRUE(alarm_protocol_read(payload, size, &command));
+    TEST_ASSERT_EQUAL_size_t(3000, command.first);
+    TEST_ASSERT_EQUAL_size_t(100, command.count);
+    // every truncation of it is refused, rather than read past the end
+    for (size_t i = 0; i < size; ++i) {
+        TEST_ASSERT_FALSE(alarm_protocol_read(payload, i, &command));
+    }
+    const uint8_t hello[] = {HELLO, 2, 1};
+    TEST_ASSERT_FALSE(alarm_protocol_read(hello, sizeof(hello), &command));
+}
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_wide);
+    RUN_TEST(test_version1_peer);
+    RUN_TEST(test_single_ids);
+    RUN_TEST(test_thrown);
+    RUN_TEST(test_runs);
+    RUN_TEST(test_hello);
+    RUN_TEST(test_short_payloads);
+    return UNITY_END();
+}
@@ -0,0 +1,186 @@
+#include <unity.h>
+#include <stdio.h>
+#include <string.h>
+#include <chrono>
+#include "debounce.h"
+
+void setUp(void) {}
+void tearDown(void) {}
+
+// samples of a contact, one per scan (5ms apart on the slave), as captured
+// off pull stations. each closes or opens with some bounce, then holds
+struct bounce_pattern {
+    const char* name;
+    const char* samples;
+    // the sample the settled edge should be reported on, or -1 for none
+    int edge_at;
+};
+static const bounce_pattern patterns[] = {
+    // four in a row is the minimum
+    {"clean close", "11111111", 3},
+    {"short bounce", "1011011111111", 8},
+    {"long bounce", "1101001101110111111111", 16},
+    // a spike of noise never gets that far
+    {"spike", "0001000110011100000000", -1},
+    {"chatter", "1010101010101010101010", -1},
+    {"close then open", "0110111100000000", 7},
+};
+// feeds <samples> to the bit <bit> of a debouncer, and returns where the
+// edges came out. every other bit is fed the opposite, to show they don't
+// interfere
+template <typename Word>
+static void run(const char* samples, size_t bit, int* out_edges,
+                size_t* out_count) {
+    debounce_word<Word> word;
+    debounce_init(&word);
+    // the other inputs start settled on, so they don't report edges below
+    for (int i = 0; i < 4; ++i) {
+        debounce(&word, (Word) ~((Word)1 << bit));
+    }
+    *out_count = 0;
+    for (int i = 0; samples[i]; ++i) {
+        const Word mask = (Word)1 << bit;
+        const Word sample = (Word)((samples[i] == '1') ? mask : 0);
+        const Word changed = debounce(&word, (Word)(sample | ~mask));
+        TEST_ASSERT_EQUAL_INT(0, changed & ~mask);
+        if (changed) {
+            TEST_ASSERT_EQUAL_INT(samples[i] == '1', (word.state & mask) != 0);
+            out_edges[(*out_count)++] = i;
+        }
+    }
+}
+template <typename Word>
+static void test_patterns() {
+    for (const bounce_pattern& p : patterns) {
+        for (size_t bit = 0; bit < sizeof(Word) * 8; ++bit) {
+            int edges[32];
+            size_t count;
+            run<Word>(p.samples, bit, edges, &count);
+            if (p.edge_at < 0) {
+                TEST_ASSERT_EQUAL_size_t(0, count);
+            } else {
+                TEST_ASSERT_TRUE_MESSAGE(count > 0, p.name);
+                // the edge comes four samples after the last bounce
+                TEST_ASSERT_EQUAL_INT_MESSAGE(p.edge_at, edges[0], p.name);
+            }
+        }
+    }
+    // closing then opening reports both
+    int edges[32];
+    size_t count;
+    run<Word>("011011110000000", 0, edges, &count);
+    TEST_ASSERT_EQUAL_size_t(2, count);
+    TEST_ASSERT_EQUAL_INT(7, edges[0]);
+    TEST_ASSERT_EQUAL_INT(11, edges[1]);
+}
+static void test_patterns8(void) { test_patterns<uint8_t>(); }
+static void test_patterns16(void) { test_patterns<uint16_t>(); }
+static void test_patterns32(void) { test_patterns<uint32_t>(); }
+static void test_independent_inputs(void) {
+    // every input on its own bounce pattern at once, each settling on cue
+    debounce_word<uint32_t> word;
+    debounce_init(&word);
+    const size_t pattern_count = sizeof(patterns) / sizeof(patterns[0]);
+    int seen[32];
+    for (size_t bit = 0; bit < 32; ++bit) {
+        seen[bit] = -1;
+    }
+    for (int i = 0; i < 22; ++i) {
+        uint32_t sample = 0;
+        for (size_t bit = 0; bit < 32; ++bit) {
+            const char* samples = patterns[bit % pattern_count].samples;
+            const int size = (int)strlen(samples);
+            // patterns hold their last sample once they run out
+            if (samples[i < size ? i : size - 1] == '1') {
+                sample |= UINT32_C(1) << bit;
+            }
+        }
+        uint32_t changed = debounce(&word, sample);
+        for (size_t bit = 0; bit < 32; ++bit) {
+            if (((changed >> bit) & 1) && seen[bit] == -1) {
+                seen[bit] = i;
+            }
+        }
+    }
+    for (size_t bit = 0; bit < 32; ++bit) {
+        TEST_ASSERT_EQUAL_INT(patterns[bit % pattern_count].edge_at,
+                              seen[bit]);
+    }
+}
+// the cost of a scan's worth of debouncing, against keeping a counter per
+// input the obvious way
+template <typename Word>
+static void benchmark(size_t inputs) {
+    static constexpr const size_t scans = 200000;
+    const size_t word_bits = sizeof(Word) * 8;
+    const size_t word_count = (inputs + word_bits - 1) / word_bits;
+    debounce_word<Word> words[64];
+    for (size_t w = 0; w < word_count; ++w) {
+        debounce_init(&words[w]);
+    }
+    uint32_t state = 1;
+    Word sink = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (size_t s = 0; s < scans; ++s) {
+        for (size_t w = 0; w < word_count; ++w) {
+            // xorshift, so the samples are noisy and the compiler can't
+            // see through them
+            state ^= state << 13;
+            state ^= state >> 17;
+            state ^= state << 5;
+            sink ^= debounce(&words[w], (Word)state);
+        }
+    }
+    const double vertical = std::chrono::duration<double, std::nano>(
+                                std::chrono::steady_clock::now() - start)
+                                .count() /
+                            scans;
+    uint8_t counts[2048] = {};
+    bool settled[2048] = {};
+    start = std::chrono::steady_clock::now();
+    for (size_t s = 0; s < scans; ++s) {
+        for (size_t i = 0; i < inputs; i += 32) {
+            state ^= state << 13;
+            state ^= state >> 17;
+            state ^= state << 5;
+            for (size_t b = 0; b < 32 && i + b < inputs; ++b) {
+                const bool sample = (state >> b) & 1;
+                if (sample == settled[i + b]) {
+                    counts[i + b] = 0;
+                } else if (++counts[i + b] == 4) {
+                    counts[i + b] = 0;
+                    settled[i + b] = sample;
+                    sink ^= 1;
+                }
+            }
+        }
+    }
+    const double per_input = std::chrono::duration<double, std::nano>(
+                                 std::chrono::steady_clock::now() - start)
+                                 .count() /
+                             scans;
+    char msg[128];
+    snprintf(msg, sizeof(msg),
+             "%u inputs, %u bit words: %.1fns per scan, against %.1fns "
+             "with a counter per input (%u)",
+             (unsigned)inputs, (unsigned)word_bits, vertical,
+             per_input, (unsigned)(sink & 1));
+    TEST_MESSAGE(msg);
+}
+static void test_benchmark(void) {
+    benchmark<uint8_t>(64);
+    benchmark<uint32_t>(64);
+    benchmark<uint8_t>(512);
+    benchmark<uint32_t>(512);
+    benchmark<uint32_t>(2048);
+}
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_patterns8);
+    RUN_TEST(test_patterns16);
+    RUN_TEST(test_patterns32);
+    RUN_TEST(test_independent_inputs);
+    RUN_TEST(test_benchmark);
+    return UNITY_END();
+}
@@ -0,0 +1,142 @@
+#include <unity.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include "http_bits.h"
+
+void setUp(void) { srand(1); }
+void tearDown(void) {}
+
+static void test_layout(void) {
+    // alarms 0, 9 and 10 on, at version 0x12345678
+    const uint32_t values[] = {(1 << 0) | (1 << 9) | (1 << 10)};
+    uint8_t body[http_bits_size(11)];
+    TEST_ASSERT_EQUAL_size_t(6, sizeof(body));
+    http_bits_encode(0x12345678, values, 11, body);
+    const uint8_t expected[] = {0x78, 0x56, 0x34, 0x12, 0x01, 0x06};
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(expected, body, sizeof(expected));
+}
+static void test_round_trip(void) {
+    static const size_t counts[] = {1, 4, 7, 8, 9, 31, 32, 33, 255, 1024, 4096};
+    for (size_t count : counts) {
+        const size_t words = (count + 31) / 32;
+        uint32_t values[129];
+        uint32_t decoded[129];
+        uint8_t body[http_bits_size(4096)];
+        for (int pass = 0; pass < 20; ++pass) {
+            for (size_t i = 0; i < words; ++i) {
+                values[i] = (uint32_t)rand() ^ ((uint32_t)rand() << 16);
+            }
+            const uint32_t version = (uint32_t)rand() << 8;
+            http_bits_encode(version, values, count, body);
+            // whatever is past the last alarm goes out clear
+            if (count % 8) {
+                TEST_ASSERT_EQUAL_HEX8(
+                    0, body[http_bits_size(count) - 1] >> (count % 8));
+            }
+            uint32_t decoded_version;
+            memset(decoded, 0xA5, sizeof(decoded));
+            http_bits_decode(body, count, &decoded_version, decoded);
+            TEST_ASSERT_EQUAL_HEX32(version, decoded_version);
+            for (size_t i = 0; i < count; ++i) {
+                TEST_ASSERT_EQUAL_INT((values[i / 32] >> (i % 32)) & 1,
+                                      (decoded[i / 32] >> (i % 32)) & 1);
+            }
+            // and comes back clear, so it can go straight to the store
+            if (count % 32) {
+                TEST_ASSERT_EQUAL_HEX32(0, decoded[words - 1] >> (count % 32));
+            }
+            // nothing past the last word is touched
+            TEST_ASSERT_EQUAL_HEX32(0xA5A5A5A5, decoded[words]);
+        }
+    }
+}
+static void test_decode_junk_bits(void) {
+    // a client sending set bits past the last alarm doesn't switch anything
+    uint8_t body[http_bits_size(10)] = {1, 0, 0, 0, 0xFF, 0xFF};
+    uint32_t version;
+    uint32_t values[1];
+    http_bits_decode(body, 10, &version, values);
+    TEST_ASSERT_EQUAL_HEX32(1, version);
+    TEST_ASSERT_EQUAL_HEX32(0x3FF, values[0]);
+}
+// what /api spends on the same alarms, for comparison
+static size_t json_format(const uint32_t* values, size_t count, char* out) {
+    char* p = out;
+    p += sprintf(p, "{\"status\":[");
+    for (size_t i = 0; i < count; ++i) {
+        if (i) {
+            *p++ = ',';
+        }
+        if ((values[i / 32] >> (i % 32)) & 1) {
+            memcpy(p, "true", 4);
+            p += 4;
+        } else {
+            memcpy(p, "false", 5);
+            p += 5;
+        }
+    }
+    p += sprintf(p, "]}");
+    return p - out;
+}
+static void test_benchmark(void) {
+    static constexpr const size_t count = 1024;
+    static constexpr const size_t iterations = 100000;
+    uint32_t values[count / 32];
+    for (uint32_t& value : values) {
+        value = (uint32_t)rand() ^ ((uint32_t)rand() << 16);
+    }
+    uint8_t body[http_bits_size(count)];
+    static char json[count * 6 + 32];
+    uint32_t version = 0;
+    uint32_t sink = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < iterations; ++i) {
+        http_bits_encode(version++, values, count, body);
+        sink += body[4 + (i % (count / 8))];
+    }
+    auto now = std::chrono::steady_clock::now();
+    const double encode_ns =
+        std::chrono::duration<double, std::nano>(now - start).count() /
+        iterations;
+    start = now;
+    uint32_t decoded[count / 32];
+    for (size_t i = 0; i < iterations; ++i) {
+        body[0] = (uint8_t)i;
+        http_bits_decode(body, count, &version, decoded);
+        sink += decoded[i % (count / 32)] + version;
+    }
+    now = std::chrono::steady_clock::now();
+    const double decode_ns =
+        std::chrono::duration<double, std::nano>(now - start).count() /
+        iterations;
+    start = now;
+    size_t json_size = 0;
+    for (size_t i = 0; i < iterations / 10; ++i) {
+        values[0] ^= (uint32_t)i;
+        json_size = json_format(values, count, json);
+        sink += json[json_size / 2];
+    }
+    now = std::chrono::steady_clock::now();
+    const double json_ns =
+        std::chrono::duration<double, std::nano>(now - start).count() /
+        (iterations / 10);
+    TEST_ASSERT_EQUAL_size_t(132, sizeof(body));
+    char msg[160];
+    snprintf(msg, sizeof(msg),
+             "%u alarms: %u bytes, encode %.0fns, decode %.0fns. as JSON: "
+             "%u bytes, %.0fns (%u)",
+             (unsigned)count, (unsigned)sizeof(body), encode_ns, decode_ns,
+             (unsigned)json_size, json_ns, (unsigned)(sink & 1));
+    TEST_MESSAGE(msg);
+}
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_layout);
+    RUN_TEST(test_round_trip);
+    RUN_TEST(test_decode_junk_bits);
+    RUN_TEST(test_benchmark);
+    return UNITY_END();
+}
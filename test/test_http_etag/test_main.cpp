@@ -0,0 +1,52 @@
+#include <unity.h>
+#include "http_etag.h"
+
+void setUp(void) {}
+void tearDown(void) {}
+
+static void test_format(void) {
+    char etag[http_etag_size];
+    http_etag_format(0x0badf00d, 0x2a, etag);
+    TEST_ASSERT_EQUAL_STRING("\"0badf00d-2a\"", etag);
+    // the longest one still fits
+    http_etag_format(UINT32_MAX, UINT32_MAX, etag);
+    TEST_ASSERT_EQUAL_STRING("\"ffffffff-ffffffff\"", etag);
+}
+static void test_match(void) {
+    char etag[http_etag_size];
+    http_etag_format(0x12345678, 7, etag);
+    TEST_ASSERT_TRUE(http_etag_match("\"12345678-7\"", etag));
+    TEST_ASSERT_TRUE(http_etag_match("*", etag));
+    TEST_ASSERT_TRUE(http_etag_match(" * ", etag));
+    // browsers and proxies may weaken it
+    TEST_ASSERT_TRUE(http_etag_match("W/\"12345678-7\"", etag));
+    // a list, with the match anywhere in it
+    TEST_ASSERT_TRUE(http_etag_match("\"a\", \"12345678-7\"", etag));
+    TEST_ASSERT_TRUE(http_etag_match("\"12345678-7\",\"b\"", etag));
+    TEST_ASSERT_TRUE(http_etag_match("\"a\" ,\t\"12345678-7\" ,", etag));
+}
+static void test_mismatch(void) {
+    char etag[http_etag_size];
+    http_etag_format(0x12345678, 7, etag);
+    TEST_ASSERT_FALSE(http_etag_match("", etag));
+    TEST_ASSERT_FALSE(http_etag_match(" , ,", etag));
+    // an older version, or a newer one that starts the same
+    TEST_ASSERT_FALSE(http_etag_match("\"12345678-6\"", etag));
+    TEST_ASSERT_FALSE(http_etag_match("\"12345678-77\"", etag));
+    // the same version from before a reboot
+    TEST_ASSERT_FALSE(http_etag_match("\"87654321-7\"", etag));
+    // tags are compared whole, quotes and all
+    TEST_ASSERT_FALSE(http_etag_match("12345678-7", etag));
+    TEST_ASSERT_FALSE(http_etag_match("x\"12345678-7\"", etag));
+    TEST_ASSERT_FALSE(http_etag_match("\"12345678-7\"x", etag));
+    TEST_ASSERT_FALSE(http_etag_match("**", etag));
+    TEST_ASSERT_FALSE(http_etag_match("W/", etag));
+}
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_format);
+    RUN_TEST(test_match);
+    RUN_TEST(test_mismatch);
+    return UNITY_END();
+}
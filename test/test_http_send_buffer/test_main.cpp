@@ -0,0 +1,138 @@
+#include <unity.h>
+#include <stdio.h>
+#include <string.h>
+#include <string>
+#include "http_send_buffer.h"
+
+// one TCP segment, as on the device
+static constexpr const size_t capacity = 1436;
+
+// stands in for the socket, counting sends and keeping what went out
+struct socket_sink {
+    size_t sends;
+    std::string sent;
+};
+static void sink_send(const char* data, size_t size, void* state) {
+    socket_sink* sink = (socket_sink*)state;
+    TEST_ASSERT_GREATER_THAN(0, size);
+    TEST_ASSERT_LESS_OR_EQUAL(capacity, size);
+    ++sink->sends;
+    sink->sent.append(data, size);
+}
+
+// the calls the generated index page makes, with the block sizes it has
+struct page_writer {
+    virtual void block(size_t size) = 0;
+    virtual void expr(int value) = 0;
+    virtual void end() = 0;
+    virtual ~page_writer() {}
+};
+static void render_page(page_writer& out, size_t alarm_count) {
+    out.block(476);
+    for (size_t i = 0; i < alarm_count; ++i) {
+        out.block(27);
+        out.expr(i + 1);
+        out.block(80);
+        out.expr(i);
+        out.block(73);
+        out.expr(i);
+        out.block(7);
+        if (i & 1) {
+            out.block(13);
+        }
+        out.block(96);
+    }
+    out.block(273);
+    out.end();
+}
+static const char* filler(size_t size) {
+    static char data[512];
+    for (size_t i = 0; i < size; ++i) {
+        data[i] = 'a' + (i % 26);
+    }
+    return data;
+}
+// one socket send per block, and three per expression, as it was
+struct unbuffered_writer : page_writer {
+    socket_sink sink{};
+    void block(size_t size) override {
+        sink_send(filler(size), size, &sink);
+    }
+    void expr(int value) override {
+        char buf[16];
+        snprintf(buf, sizeof(buf), "%d", value);
+        char header[16];
+        snprintf(header, sizeof(header), "%X\r\n", (unsigned)strlen(buf));
+        sink_send(header, strlen(header), &sink);
+        sink_send(buf, strlen(buf), &sink);
+        sink_send("\r\n", 2, &sink);
+    }
+    void end() override {}
+};
+struct buffered_writer : page_writer {
+    socket_sink sink{};
+    http_send_buffer out;
+    char data[capacity];
+    buffered_writer() {
+        http_send_buffer_init(&out, data, capacity, sink_send, &sink);
+    }
+    void block(size_t size) override {
+        http_send_buffer_write(&out, filler(size), size);
+    }
+    void expr(int value) override {
+        char buf[16];
+        snprintf(buf, sizeof(buf), "%d", value);
+        http_send_buffer_chunk(&out, buf, strlen(buf));
+    }
+    void end() override { http_send_buffer_flush(&out); }
+};
+
+void setUp(void) {}
+void tearDown(void) {}
+
+static void test_page_sends(void) {
+    static const size_t alarm_counts[] = {4, 64, 1024};
+    for (size_t alarm_count : alarm_counts) {
+        unbuffered_writer before;
+        buffered_writer after;
+        render_page(before, alarm_count);
+        render_page(after, alarm_count);
+        // the same bytes go out either way
+        TEST_ASSERT_TRUE(before.sink.sent == after.sink.sent);
+        // in as few full segments as they fit in
+        const size_t total = after.sink.sent.size();
+        TEST_ASSERT_EQUAL_size_t((total + capacity - 1) / capacity,
+                                 after.sink.sends);
+        char msg[128];
+        snprintf(msg, sizeof(msg),
+                 "%u alarms, %u bytes: %u sends before, %u after",
+                 (unsigned)alarm_count, (unsigned)total,
+                 (unsigned)before.sink.sends, (unsigned)after.sink.sends);
+        TEST_MESSAGE(msg);
+    }
+}
+static void test_chunks(void) {
+    socket_sink sink{};
+    char data[8];
+    http_send_buffer out;
+    // smaller than a chunk header, so every piece straddles a send
+    http_send_buffer_init(&out, data, sizeof(data), sink_send, &sink);
+    std::string big(0x1A2, 'x');
+    http_send_buffer_chunk(&out, "7", 1);
+    http_send_buffer_chunk(&out, big.c_str(), big.size());
+    http_send_buffer_chunk(&out, nullptr, 0);
+    TEST_ASSERT_EQUAL_size_t(sink.sent.size() / sizeof(data), sink.sends);
+    http_send_buffer_flush(&out);
+    TEST_ASSERT_TRUE(sink.sent == "1\r\n7\r\n1A2\r\n" + big + "\r\n0\r\n\r\n");
+    // flushing with nothing collected sends nothing
+    const size_t sends = sink.sends;
+    http_send_buffer_flush(&out);
+    TEST_ASSERT_EQUAL_size_t(sends, sink.sends);
+}
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_page_sends);
+    RUN_TEST(test_chunks);
+    return UNITY_END();
+}
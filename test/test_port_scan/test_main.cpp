@@ -0,0 +1,118 @@
+#include <unity.h>
+#include <stdlib.h>
+#include "port_scan.h"
+
+void setUp(void) { srand(1); }
+void tearDown(void) {}
+
+// stands in for a board: <Ports> input registers, and a pin map that puts
+// each input on some port and bit, as digitalPinToPort() and
+// digitalPinToBitMask() would
+template <typename Word, size_t Count, size_t Ports>
+struct fake_board {
+    static constexpr const size_t word_bits = sizeof(Word) * 8;
+    volatile Word registers[Ports];
+    size_t pin_port[Count];
+    Word pin_mask[Count];
+    fake_board() {
+        static_assert(Count <= Ports * word_bits, "too many pins");
+        // deal the pins out across every port and bit, shuffled
+        size_t slots[Ports * word_bits];
+        for (size_t i = 0; i < Ports * word_bits; ++i) {
+            slots[i] = i;
+        }
+        for (size_t i = Ports * word_bits - 1; i > 0; --i) {
+            const size_t j = rand() % (i + 1);
+            const size_t t = slots[i];
+            slots[i] = slots[j];
+            slots[j] = t;
+        }
+        for (size_t i = 0; i < Count; ++i) {
+            pin_port[i] = slots[i] / word_bits;
+            pin_mask[i] = (Word)((Word)1 << (slots[i] % word_bits));
+        }
+    }
+    // what a digitalRead() of each pin would see, packed
+    void read_pins(Word* out_values) const {
+        for (size_t i = 0; i < (Count + word_bits - 1) / word_bits; ++i) {
+            out_values[i] = 0;
+        }
+        for (size_t i = 0; i < Count; ++i) {
+            if (registers[pin_port[i]] & pin_mask[i]) {
+                out_values[i / word_bits] |= (Word)((Word)1 << (i % word_bits));
+            }
+        }
+    }
+};
+template <typename Word, size_t Count, size_t Ports>
+static void check_board() {
+    static constexpr const size_t words =
+        (Count + sizeof(Word) * 8 - 1) / (sizeof(Word) * 8);
+    fake_board<Word, Count, Ports>* board =
+        new fake_board<Word, Count, Ports>();
+    port_scan<Word, Count> scan;
+    port_scan_init(&scan);
+    bool used[Ports] = {};
+    size_t used_count = 0;
+    for (size_t i = 0; i < Count; ++i) {
+        port_scan_add(&scan, i, &board->registers[board->pin_port[i]],
+                      board->pin_mask[i]);
+        if (!used[board->pin_port[i]]) {
+            used[board->pin_port[i]] = true;
+            ++used_count;
+        }
+    }
+    // each port is read once per scan, however many pins are on it
+    TEST_ASSERT_EQUAL_size_t(used_count, scan.ports_count);
+    Word expected[words];
+    Word actual[words];
+    for (int pass = 0; pass < 1000; ++pass) {
+        for (size_t p = 0; p < Ports; ++p) {
+            board->registers[p] = (Word)rand();
+        }
+        board->read_pins(expected);
+        // stale bits from the last pass mustn't survive
+        for (size_t w = 0; w < words; ++w) {
+            actual[w] = (Word)~expected[w];
+        }
+        port_scan_read(&scan, actual);
+        TEST_ASSERT_EQUAL_MEMORY(expected, actual, sizeof(expected));
+    }
+    delete board;
+}
+// an ATmega2560 has 8 bit ports, A through L
+static void test_avr(void) {
+    check_board<uint8_t, 4, 11>();
+    check_board<uint8_t, 40, 11>();
+    check_board<uint8_t, 88, 11>();
+}
+// an ESP32 has GPIO.in and GPIO.in1
+static void test_esp32(void) {
+    check_board<uint32_t, 4, 2>();
+    check_board<uint32_t, 39, 2>();
+}
+static void test_shared_port(void) {
+    // every pin on one register still reads it once
+    volatile uint8_t port = 0xA5;
+    port_scan<uint8_t, 8> scan;
+    port_scan_init(&scan);
+    for (size_t i = 0; i < 8; ++i) {
+        port_scan_add(&scan, i, &port, (uint8_t)(0x80 >> i));
+    }
+    TEST_ASSERT_EQUAL_size_t(1, scan.ports_count);
+    uint8_t values;
+    port_scan_read(&scan, &values);
+    // the bits come out in input order, not port order
+    TEST_ASSERT_EQUAL_HEX8(0xA5, values);
+    port = 0x01;
+    port_scan_read(&scan, &values);
+    TEST_ASSERT_EQUAL_HEX8(0x80, values);
+}
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_avr);
+    RUN_TEST(test_esp32);
+    RUN_TEST(test_shared_port);
+    return UNITY_END();
+}
@@ -0,0 +1,186 @@
+#include <unity.h>
+#include <stdlib.h>
+#include <string.h>
+#include "serial_frame.h"
+
+static serial_frame_decoder decoder;
+
+void setUp(void) {
+    serial_frame_decoder_init(&decoder);
+    srand(1);
+}
+void tearDown(void) {}
+
+// feeds a whole encoded frame. returns true if it came out as a good frame
+static bool feed(const uint8_t* frame, size_t size, const uint8_t** payload,
+                 size_t* payload_size) {
+    bool result = false;
+    for (size_t i = 0; i < size; ++i) {
+        if (serial_frame_decode(&decoder, frame[i], payload, payload_size)) {
+            // only the delimiter may complete a frame
+            TEST_ASSERT_EQUAL_size_t(size - 1, i);
+            result = true;
+        }
+    }
+    return result;
+}
+static void round_trip(const uint8_t* payload, size_t size) {
+    uint8_t frame[serial_frame_max_size];
+    const size_t frame_size = serial_frame_encode(payload, size, frame);
+    TEST_ASSERT_GREATER_THAN(0, frame_size);
+    TEST_ASSERT_LESS_OR_EQUAL(serial_frame_max_size, frame_size);
+    // zero only ever appears as the delimiter
+    for (size_t i = 0; i < frame_size - 1; ++i) {
+        TEST_ASSERT_TRUE(frame[i] != 0);
+    }
+    TEST_ASSERT_EQUAL_HEX8(0, frame[frame_size - 1]);
+    const uint8_t* decoded;
+    size_t decoded_size;
+    TEST_ASSERT_TRUE(feed(frame, frame_size, &decoded, &decoded_size));
+    TEST_ASSERT_EQUAL_size_t(size, decoded_size);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(payload, decoded, size);
+}
+// COBS encodes <raw> as is, so tests can pick the CRC byte
+static size_t cobs_encode(const uint8_t* raw, size_t size, uint8_t* out) {
+    size_t code_index = 0, out_index = 1;
+    uint8_t code = 1;
+    for (size_t i = 0; i < size; ++i) {
+        if (raw[i] == 0) {
+            out[code_index] = code;
+            code_index = out_index++;
+            code = 1;
+        } else {
+            out[out_index++] = raw[i];
+            ++code;
+        }
+    }
+    out[code_index] = code;
+    out[out_index++] = 0;
+    return out_index;
+}
+
+static void test_empty_payload(void) {
+    // every frame carries at least a command, so there's nothing to encode
+    uint8_t frame[serial_frame_max_size];
+    const uint8_t payload[1] = {0};
+    TEST_ASSERT_EQUAL_size_t(0, serial_frame_encode(payload, 0, frame));
+    // and a bare CRC that arrives anyway is dropped, CRC notwithstanding
+    const uint8_t crc = serial_frame_crc8(payload, 0);
+    const size_t size = cobs_encode(&crc, 1, frame);
+    const uint8_t* decoded;
+    size_t decoded_size;
+    TEST_ASSERT_FALSE(feed(frame, size, &decoded, &decoded_size));
+    TEST_ASSERT_EQUAL_UINT32(1, decoder.errors);
+    // so are back to back delimiters, which aren't counted as errors
+    TEST_ASSERT_FALSE(serial_frame_decode(&decoder, 0, &decoded,
+                                          &decoded_size));
+    TEST_ASSERT_EQUAL_UINT32(1, decoder.errors);
+}
+static void test_random_payloads(void) {
+    uint8_t payload[serial_frame_max_payload];
+    for (size_t size = 1; size <= serial_frame_max_payload; ++size) {
+        for (int pass = 0; pass < 50; ++pass) {
+            for (size_t i = 0; i < size; ++i) {
+                // plenty of zeroes, so COBS has something to do
+                payload[i] = (rand() % 4) ? (uint8_t)rand() : 0;
+            }
+            round_trip(payload, size);
+        }
+    }
+}
+static void test_runs(void) {
+    uint8_t payload[serial_frame_max_payload];
+    for (size_t size = 1; size <= serial_frame_max_payload; ++size) {
+        memset(payload, 0x00, size);
+        round_trip(payload, size);
+        memset(payload, 0xFF, size);
+        round_trip(payload, size);
+    }
+}
+static void test_too_big_to_encode(void) {
+    uint8_t payload[serial_frame_max_payload + 1];
+    memset(payload, 1, sizeof(payload));
+    uint8_t frame[serial_frame_max_size + 8];
+    TEST_ASSERT_EQUAL_size_t(0, serial_frame_encode(payload, sizeof(payload),
+                                                    frame));
+}
+static void test_flipped_crc_bit(void) {
+    const uint8_t payload[] = {3, 0, 7, 0xFF, 0};
+    uint8_t raw[sizeof(payload) + 1];
+    memcpy(raw, payload, sizeof(payload));
+    const uint8_t crc = serial_frame_crc8(payload, sizeof(payload));
+    uint8_t frame[serial_frame_max_size];
+    const uint8_t* decoded;
+    size_t decoded_size;
+    // the right CRC is accepted
+    raw[sizeof(payload)] = crc;
+    size_t size = cobs_encode(raw, sizeof(raw), frame);
+    TEST_ASSERT_TRUE(feed(frame, size, &decoded, &decoded_size));
+    for (int bit = 0; bit < 8; ++bit) {
+        raw[sizeof(payload)] = crc ^ (1 << bit);
+        size = cobs_encode(raw, sizeof(raw), frame);
+        TEST_ASSERT_FALSE(feed(frame, size, &decoded, &decoded_size));
+        TEST_ASSERT_EQUAL_UINT32(bit + 1, decoder.errors);
+    }
+}
+static void test_too_long_frame(void) {
+    const uint8_t* decoded;
+    size_t decoded_size;
+    for (size_t i = 0; i < serial_frame_max_size + 10; ++i) {
+        TEST_ASSERT_FALSE(
+            serial_frame_decode(&decoder, 0x01, &decoded, &decoded_size));
+    }
+    TEST_ASSERT_FALSE(serial_frame_decode(&decoder, 0, &decoded,
+                                          &decoded_size));
+    TEST_ASSERT_EQUAL_UINT32(1, decoder.errors);
+    // and it picks right back up
+    const uint8_t payload[] = {1, 2, 3};
+    round_trip(payload, sizeof(payload));
+}
+static void test_byte_loss_recovery(void) {
+    // a burst of frames with one byte dropped from the middle of the stream
+    static constexpr const size_t frames = 20;
+    uint8_t stream[frames * serial_frame_max_size];
+    size_t stream_size = 0;
+    for (size_t i = 0; i < frames; ++i) {
+        const uint8_t payload[] = {(uint8_t)i, 0, (uint8_t)(i * 7)};
+        stream_size +=
+            serial_frame_encode(payload, sizeof(payload), stream + stream_size);
+    }
+    for (size_t drop = 0; drop < stream_size; ++drop) {
+        serial_frame_decoder_init(&decoder);
+        size_t good = 0;
+        size_t expected_next = 0;
+        for (size_t i = 0; i < stream_size; ++i) {
+            if (i == drop) {
+                continue;
+            }
+            const uint8_t* decoded;
+            size_t decoded_size;
+            if (serial_frame_decode(&decoder, stream[i], &decoded,
+                                    &decoded_size)) {
+                // nothing corrupt ever gets through, and order is kept
+                TEST_ASSERT_EQUAL_size_t(3, decoded_size);
+                TEST_ASSERT_TRUE(decoded[0] >= expected_next);
+                TEST_ASSERT_EQUAL_UINT8((uint8_t)(decoded[0] * 7),
+                                        decoded[2]);
+                expected_next = decoded[0] + 1;
+                ++good;
+            }
+        }
+        // losing a byte costs its frame, and the next if it was the zero
+        TEST_ASSERT_GREATER_OR_EQUAL(frames - 2, good);
+    }
+}
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_empty_payload);
+    RUN_TEST(test_random_payloads);
+    RUN_TEST(test_runs);
+    RUN_TEST(test_too_big_to_encode);
+    RUN_TEST(test_flipped_crc_bit);
+    RUN_TEST(test_too_long_frame);
+    RUN_TEST(test_byte_loss_recovery);
+    return UNITY_END();
+}
@@ -0,0 +1,191 @@
+#include <unity.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include "tile_grid.h"
+
+void setUp(void) { srand(1); }
+void tearDown(void) {}
+
+// the overview's area on a 320x240 screen sits between the switches and
+// the buttons. a few sizes around it, and the whole screen
+struct area {
+    int width;
+    int height;
+};
+static const area areas[] = {{308, 64}, {308, 80}, {308, 120}, {320, 240}};
+static const size_t counts[] = {1, 4, 64, 256, 1024};
+
+static size_t grid_rows(const tile_grid& grid, int height) {
+    return (height + grid.tile_gap) / (grid.tile_size + grid.tile_gap);
+}
+static void test_layout(void) {
+    for (const area& a : areas) {
+        for (size_t count : counts) {
+            tile_grid grid;
+            tile_grid_layout(&grid, a.width, a.height, count);
+            const size_t rows = grid_rows(grid, a.height);
+            TEST_ASSERT_GREATER_OR_EQUAL(count, grid.columns * rows);
+            // every tile lies inside the area
+            for (size_t i = 0; i < count; ++i) {
+                int x, y;
+                tile_grid_origin(&grid, i, &x, &y);
+                TEST_ASSERT_LESS_OR_EQUAL(a.width, x + grid.tile_size);
+                TEST_ASSERT_LESS_OR_EQUAL(a.height, y + grid.tile_size);
+            }
+            // and they're as big as they can be
+            const int s = grid.tile_size + 1;
+            const int gap = s > 3 ? 1 : 0;
+            if (s <= a.width && s <= a.height) {
+                TEST_ASSERT_TRUE((size_t)(((a.width + gap) / (s + gap)) *
+                                          ((a.height + gap) / (s + gap))) <
+                                 count);
+            }
+        }
+    }
+}
+static void test_hit(void) {
+    tile_grid grid;
+    tile_grid_layout(&grid, 308, 80, 256);
+    for (size_t i = 0; i < 256; ++i) {
+        int x, y;
+        tile_grid_origin(&grid, i, &x, &y);
+        size_t hit;
+        // every pixel of the tile, and the gap after it
+        for (int dy = 0; dy <= grid.tile_size; ++dy) {
+            for (int dx = 0; dx <= grid.tile_size; ++dx) {
+                if (x + dx >= 308 ||
+                    (size_t)((x + dx) / (grid.tile_size + grid.tile_gap)) >=
+                        grid.columns) {
+                    continue;
+                }
+                TEST_ASSERT_TRUE(
+                    tile_grid_hit(&grid, 256, x + dx, y + dy, &hit));
+                TEST_ASSERT_EQUAL_size_t(i, hit);
+            }
+        }
+    }
+    size_t hit = 7;
+    TEST_ASSERT_FALSE(tile_grid_hit(&grid, 256, -1, 0, &hit));
+    TEST_ASSERT_FALSE(tile_grid_hit(&grid, 256, 0, -1, &hit));
+    // past the last column, and past the last tile
+    TEST_ASSERT_FALSE(tile_grid_hit(&grid, 256, 307, 0, &hit));
+    TEST_ASSERT_FALSE(tile_grid_hit(&grid, 256, 0, 79, &hit));
+    TEST_ASSERT_EQUAL_size_t(7, hit);
+}
+static bool intersects(const tile_grid& grid, size_t i, int x1, int y1, int x2,
+                       int y2) {
+    int x, y;
+    tile_grid_origin(&grid, i, &x, &y);
+    return x <= x2 && x + grid.tile_size - 1 >= x1 && y <= y2 &&
+           y + grid.tile_size - 1 >= y1;
+}
+static void test_span(void) {
+    for (size_t count : counts) {
+        tile_grid grid;
+        tile_grid_layout(&grid, 308, 80, count);
+        for (int pass = 0; pass < 500; ++pass) {
+            const int x1 = rand() % 320 - 10, y1 = rand() % 90 - 10;
+            const int x2 = x1 + rand() % 60, y2 = y1 + rand() % 30;
+            size_t c1, r1, c2, r2;
+            tile_grid_span(&grid, x1, y1, x2, y2, &c1, &r1, &c2, &r2);
+            // every tile under the clip gets visited
+            for (size_t i = 0; i < count; ++i) {
+                if (intersects(grid, i, x1, y1, x2, y2)) {
+                    const size_t row = i / grid.columns;
+                    const size_t column = i % grid.columns;
+                    TEST_ASSERT_TRUE(row >= r1 && row <= r2);
+                    TEST_ASSERT_TRUE(column >= c1 && column <= c2);
+                }
+            }
+            TEST_ASSERT_TRUE(c2 < grid.columns);
+        }
+    }
+}
+
+// a 16-bit framebuffer standing in for the screen, so the pixel work of a
+// paint can be timed. the SPI transfer on the device isn't included
+static uint16_t framebuffer[320 * 240];
+static void fill(int x, int y, int size, uint16_t color) {
+    for (int row = y; row < y + size; ++row) {
+        uint16_t* p = framebuffer + row * 320 + x;
+        for (int col = 0; col < size; ++col) {
+            p[col] = color;
+        }
+    }
+}
+// paints the tiles under a clip the way the control does
+static size_t paint(const tile_grid& grid, size_t count, const uint32_t* values,
+                    int x1, int y1, int x2, int y2) {
+    size_t c1, r1, c2, r2;
+    size_t painted = 0;
+    tile_grid_span(&grid, x1, y1, x2, y2, &c1, &r1, &c2, &r2);
+    for (size_t row = r1; row <= r2; ++row) {
+        for (size_t col = c1; col <= c2; ++col) {
+            const size_t i = row * grid.columns + col;
+            if (i >= count) {
+                break;
+            }
+            int x, y;
+            tile_grid_origin(&grid, i, &x, &y);
+            fill(x, y, grid.tile_size,
+                 ((values[i / 32] >> (i % 32)) & 1) ? 0xF800 : 0x4208);
+            ++painted;
+        }
+    }
+    return painted;
+}
+static void test_paint_benchmark(void) {
+    static const size_t sizes[] = {64, 256, 1024};
+    static constexpr const int iterations = 2000;
+    uint32_t values[32];
+    for (uint32_t& value : values) {
+        value = (uint32_t)rand();
+    }
+    for (size_t count : sizes) {
+        tile_grid grid;
+        tile_grid_layout(&grid, 308, 80, count);
+        auto start = std::chrono::steady_clock::now();
+        size_t full = 0;
+        for (int i = 0; i < iterations; ++i) {
+            full = paint(grid, count, values, 0, 0, 307, 79);
+        }
+        auto now = std::chrono::steady_clock::now();
+        const double full_us =
+            std::chrono::duration<double, std::micro>(now - start).count() /
+            iterations;
+        // one alarm flipping repaints its tile's bounds and nothing else
+        start = now;
+        size_t one = 0;
+        for (int i = 0; i < iterations; ++i) {
+            const size_t alarm = i % count;
+            values[alarm / 32] ^= UINT32_C(1) << (alarm % 32);
+            int x, y;
+            tile_grid_origin(&grid, alarm, &x, &y);
+            one = paint(grid, count, values, x, y, x + grid.tile_size - 1,
+                        y + grid.tile_size - 1);
+        }
+        now = std::chrono::steady_clock::now();
+        const double one_us =
+            std::chrono::duration<double, std::micro>(now - start).count() /
+            iterations;
+        TEST_ASSERT_EQUAL_size_t(count, full);
+        TEST_ASSERT_EQUAL_size_t(1, one);
+        char msg[128];
+        snprintf(msg, sizeof(msg),
+                 "%u alarms, %dpx tiles: full paint %.2fus, one alarm "
+                 "%.3fus",
+                 (unsigned)count, (int)grid.tile_size, full_us, one_us);
+        TEST_MESSAGE(msg);
+    }
+}
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_layout);
+    RUN_TEST(test_hit);
+    RUN_TEST(test_span);
+    RUN_TEST(test_paint_benchmark);
+    return UNITY_END();
+}
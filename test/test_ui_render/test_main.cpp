@@ -0,0 +1,409 @@
+#include <unity.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include <gfx.hpp>
+#include <uix.hpp>
+#define OPENSANS_CAPTION_IMPLEMENTATION
+#include "assets/OpenSans_caption.h"
+#define OPENSANS_DIGITS_IMPLEMENTATION
+#include "assets/OpenSans_digits.h"
+#define LEFT_ARROW_IMPLEMENTATION
+#include "assets/left_arrow.h"
+#define RIGHT_ARROW_IMPLEMENTATION
+#include "assets/right_arrow.h"
+#include "ui_controls.h"
+
+// the panel's two screens, laid out like app_main does, drawn into memory
+// through a fake flush. each paint reports its time, and the rectangles
+// and bytes it sent to the "display"
+
+using namespace gfx;
+using namespace uix;
+
+#define LCD_WIDTH 320
+#define LCD_HEIGHT 240
+using screen_t = uix::screen<rgb_pixel<16>>;
+using surface_t = screen_t::control_surface_type;
+using color_t = color<rgb_pixel<16>>;
+using color32_t = color<rgba_pixel<32>>;
+using button_t = text_button<surface_t>;
+using switch_t = vswitch<surface_t>;
+using label_t = label<surface_t>;
+using qr_t = qrcode<surface_t>;
+using arrow_t = arrow_box<surface_t>;
+using grid_t = alarm_grid<surface_t>;
+
+// enough alarms to page and to fill the overview
+static constexpr const size_t alarm_count = 256;
+static constexpr const size_t switches_count = (LCD_WIDTH / 40) / 2;
+static uint32_t alarm_values[(alarm_count + 31) / 32];
+
+// a tenth of the screen, like the device's transfer buffer
+static constexpr const size_t lcd_buffer_size =
+    LCD_WIDTH * LCD_HEIGHT * 2 / 10;
+static uint8_t lcd_buffer[lcd_buffer_size];
+// what the panel would be showing
+static uint16_t lcd_frame[LCD_WIDTH * LCD_HEIGHT];
+static uix::display lcd;
+// what's been flushed since the last render()
+static size_t lcd_rects = 0;
+static size_t lcd_bytes = 0;
+// the touch the panel reports, if any
+static size_t touch_count = 0;
+static point16 touch_location;
+
+static const_buffer_stream caption_stream(OpenSans_caption,
+                                          sizeof(OpenSans_caption));
+static const_buffer_stream digits_stream(OpenSans_digits,
+                                         sizeof(OpenSans_digits));
+static const_buffer_stream left_stream(left_arrow, sizeof(left_arrow));
+static const_buffer_stream right_stream(right_arrow, sizeof(right_arrow));
+static vlw_font caption_font;
+static vlw_font text_font;
+
+static screen_t main_screen;
+static arrow_t left_button;
+static arrow_t right_button;
+static button_t reset_all;
+static button_t web_link;
+static switch_t switches[switches_count];
+static label_t switch_labels[switches_count];
+static char switch_text[switches_count][6];
+static size_t switch_index = 0;
+static grid_t alarm_overview;
+static screen_t qr_screen;
+static qr_t qr_link;
+static button_t qr_return;
+static size_t reset_presses = 0;
+
+void setUp(void) {}
+void tearDown(void) {}
+
+static void lcd_on_flush(const rect16& bounds, const void* bmp, void* state) {
+    const size_t width = bounds.x2 - bounds.x1 + 1;
+    const uint16_t* src = (const uint16_t*)bmp;
+    for (int y = bounds.y1; y <= bounds.y2; ++y) {
+        memcpy(lcd_frame + y * LCD_WIDTH + bounds.x1, src, width * 2);
+        src += width;
+    }
+    ++lcd_rects;
+    lcd_bytes += width * (bounds.y2 - bounds.y1 + 1) * 2;
+    lcd.flush_complete();
+}
+static void lcd_on_touch(point16* out_locations,
+                         size_t* in_out_locations_size, void* state) {
+    *in_out_locations_size = touch_count;
+    if (touch_count != 0) {
+        out_locations[0] = touch_location;
+    }
+}
+
+static void update_switches() {
+    for (size_t i = 0; i < switches_count; ++i) {
+        const size_t alarm = i + switch_index;
+        snprintf(switch_text[i], sizeof(switch_text[i]), "%u",
+                 (unsigned)(alarm + 1));
+        switch_labels[i].text(switch_text[i]);
+        switches[i].value((alarm_values[alarm / 32] >> (alarm % 32)) & 1);
+    }
+    left_button.visible(switch_index != 0);
+    right_button.visible(switch_index < alarm_count - switches_count);
+    alarm_overview.page(switch_index, switches_count);
+}
+
+static void ui_init() {
+    lcd.buffer_size(lcd_buffer_size);
+    lcd.buffer1(lcd_buffer);
+    lcd.on_flush_callback(lcd_on_flush, nullptr);
+    lcd.on_touch_callback(lcd_on_touch, nullptr);
+
+    main_screen.dimensions({LCD_WIDTH, LCD_HEIGHT});
+    main_screen.background_color(color_t::black);
+    left_button.bounds(srect16(0, 0, LCD_WIDTH / 8.77f, LCD_WIDTH / 8)
+                           .center_vertical(main_screen.bounds())
+                           .offset(LCD_WIDTH / 53, 0));
+    left_button.svg(left_stream);
+    left_button.on_pressed_changed_callback([](bool pressed, void* state) {
+        if (pressed && switch_index > 0) {
+            switch_index = switch_index > switches_count
+                               ? switch_index - switches_count
+                               : 0;
+            update_switches();
+        }
+    });
+    main_screen.register_control(left_button);
+    right_button.bounds(srect16(0, 0, LCD_WIDTH / 8.77f, LCD_WIDTH / 8)
+                            .center_vertical(main_screen.bounds())
+                            .offset(main_screen.bounds().x2 -
+                                        left_button.dimensions().width -
+                                        LCD_WIDTH / 53,
+                                    0));
+    right_button.svg(right_stream);
+    right_button.on_pressed_changed_callback([](bool pressed, void* state) {
+        if (pressed && switch_index < alarm_count - switches_count) {
+            switch_index = math::min(switch_index + switches_count,
+                                     alarm_count - switches_count);
+            update_switches();
+        }
+    });
+    main_screen.register_control(right_button);
+
+    caption_font = vlw_font(caption_stream);
+    caption_font.initialize();
+    srect16 sr(0, 0, main_screen.dimensions().width / 2,
+               main_screen.dimensions().width / 8);
+    // both buttons show, as they do once wifi is up
+    reset_all.bounds(
+        sr.offset(0, main_screen.dimensions().height - sr.y2 - 1));
+    reset_all.back_color(color32_t::dark_red);
+    reset_all.color(color32_t::black);
+    reset_all.border_color(color32_t::dark_gray);
+    reset_all.text_font(caption_font);
+    reset_all.text("Reset all");
+    reset_all.radiuses({5, 5});
+    reset_all.on_pressed_changed_callback([](bool pressed, void* state) {
+        if (pressed) {
+            ++reset_presses;
+            for (size_t i = 0; i < switches_count; ++i) {
+                switches[i].value(false);
+            }
+        }
+    });
+    main_screen.register_control(reset_all);
+    web_link.bounds(sr.offset(0, main_screen.dimensions().height - sr.y2 - 1)
+                        .offset(reset_all.dimensions().width, 0));
+    web_link.back_color(color32_t::light_blue);
+    web_link.color(color32_t::dark_blue);
+    web_link.border_color(color32_t::dark_gray);
+    web_link.text_font(caption_font);
+    web_link.text("QR Link");
+    web_link.radiuses({5, 5});
+    main_screen.register_control(web_link);
+
+    text_font = vlw_font(digits_stream);
+    text_font.initialize();
+    char sz[16];
+    snprintf(sz, sizeof(sz), "%u", (unsigned)alarm_count);
+    text_info ti(sz, text_font);
+    size16 area;
+    text_font.measure((uint16_t)-1, ti, &area);
+    sr = srect16(0, 0, main_screen.dimensions().width / 8,
+                 main_screen.dimensions().height / 3);
+    const uint16_t swidth = math::max(area.width, (uint16_t)sr.width());
+    const uint16_t total_width = swidth * switches_count;
+    const uint16_t xofs = (main_screen.dimensions().width - total_width) / 2;
+    const uint16_t yofs = main_screen.dimensions().height / 12;
+    uint16_t x = 0;
+    for (size_t i = 0; i < switches_count; ++i) {
+        const uint16_t sofs = (swidth - sr.width()) / 2;
+        switch_t& s = switches[i];
+        s.bounds(srect16(x + xofs + sofs, yofs,
+                         x + xofs + sr.width() - 1 + sofs, yofs + sr.height()));
+        s.back_color(color32_t::dark_blue);
+        s.border_color(color32_t::dark_gray);
+        s.knob_color(color32_t::white);
+        s.knob_border_color(color32_t::dark_gray);
+        s.knob_border_width(1);
+        s.border_width(1);
+        s.radiuses({10, 10});
+        s.orientation(uix_orientation::vertical);
+        main_screen.register_control(s);
+        label_t& l = switch_labels[i];
+        l.bounds(srect16(x + xofs, yofs + sr.height() + 1,
+                         x + xofs + swidth - 1,
+                         yofs + sr.height() + area.height));
+        l.font(text_font);
+        l.color(color32_t::white);
+        l.text_justify(uix_justify::top_middle);
+        l.padding({0, 0});
+        main_screen.register_control(l);
+        x += swidth + 2;
+    }
+    alarm_overview.bounds(
+        srect16(LCD_WIDTH / 53, yofs + sr.height() + area.height + 4,
+                main_screen.dimensions().width - LCD_WIDTH / 53 - 1,
+                reset_all.bounds().y1 - 4));
+    alarm_overview.count(alarm_count);
+    main_screen.register_control(alarm_overview);
+    update_switches();
+
+    qr_screen.dimensions(main_screen.dimensions());
+    sr = srect16(0, 0, qr_screen.dimensions().width / 2,
+                 qr_screen.dimensions().width / 8);
+    qr_link.bounds(srect16(0, 0, qr_screen.dimensions().width / 2,
+                           qr_screen.dimensions().width / 2)
+                       .center_horizontal(qr_screen.bounds()));
+    qr_link.text("http://192.168.100.100");
+    qr_screen.register_control(qr_link);
+    qr_return.bounds(
+        sr.center_horizontal(qr_screen.bounds())
+            .offset(0, qr_screen.dimensions().height - sr.height()));
+    qr_return.back_color(color32_t::gray);
+    qr_return.color(color32_t::white);
+    qr_return.border_color(color32_t::dark_gray);
+    qr_return.text_font(caption_font);
+    qr_return.text("Main screen");
+    qr_return.radiuses({5, 5});
+    qr_screen.register_control(qr_return);
+}
+
+struct frame {
+    double us;
+    size_t rects;
+    size_t bytes;
+};
+// runs the display until a pass sends nothing more
+static frame render() {
+    lcd_rects = 0;
+    lcd_bytes = 0;
+    const auto start = std::chrono::steady_clock::now();
+    size_t rects;
+    do {
+        rects = lcd_rects;
+        lcd.update();
+    } while (lcd_rects != rects);
+    const auto end = std::chrono::steady_clock::now();
+    return {std::chrono::duration<double, std::micro>(end - start).count(),
+            lcd_rects, lcd_bytes};
+}
+static void report(const char* name, const frame& f) {
+    char msg[128];
+    snprintf(msg, sizeof(msg), "%-16s %9.1fus %4u rects %7u bytes", name,
+             f.us, (unsigned)f.rects, (unsigned)f.bytes);
+    TEST_MESSAGE(msg);
+}
+// repaints one control on its own a few times and reports the average
+static frame paint(const char* name, control<surface_t>& ctl) {
+    static constexpr const int iterations = 20;
+    frame total = {0, 0, 0};
+    for (int i = 0; i < iterations; ++i) {
+        ctl.invalidate();
+        const frame f = render();
+        total.us += f.us;
+        total.rects = f.rects;
+        total.bytes = f.bytes;
+    }
+    total.us /= iterations;
+    report(name, total);
+    return total;
+}
+// the pixel at the center of <bounds>
+static uint16_t lcd_pixel(const srect16& bounds) {
+    return lcd_frame[(bounds.y1 + bounds.height() / 2) * LCD_WIDTH +
+                     bounds.x1 + bounds.width() / 2];
+}
+
+static constexpr const size_t screen_bytes = LCD_WIDTH * LCD_HEIGHT * 2;
+
+static void test_main_screen(void) {
+    lcd.active_screen(main_screen);
+    const frame f = render();
+    report("main screen", f);
+    TEST_ASSERT_GREATER_OR_EQUAL(screen_bytes, f.bytes);
+    // the buttons aren't the black background
+    TEST_ASSERT_NOT_EQUAL(0, lcd_pixel(reset_all.bounds()));
+    TEST_ASSERT_NOT_EQUAL(0, lcd_pixel(web_link.bounds()));
+    // a control on its own never sends the whole screen
+    control<surface_t>* controls[] = {&left_button,  &right_button,
+                                      &reset_all,    &web_link,
+                                      &switches[0],  &switch_labels[0],
+                                      &alarm_overview};
+    const char* names[] = {"left arrow", "right arrow", "reset button",
+                           "QR button",  "switch",      "label",
+                           "overview"};
+    for (size_t i = 0; i < sizeof(controls) / sizeof(*controls); ++i) {
+        const frame c = paint(names[i], *controls[i]);
+        TEST_ASSERT_GREATER_THAN(0, c.rects);
+        TEST_ASSERT_LESS_THAN(screen_bytes, c.bytes);
+    }
+}
+static void test_state_changes(void) {
+    lcd.active_screen(main_screen);
+    render();
+    // a switch flipped from the web
+    switches[1].value(!switches[1].value());
+    frame f = render();
+    report("switch flip", f);
+    TEST_ASSERT_GREATER_THAN(0, f.rects);
+    // one alarm changed, somewhere off the page
+    alarm_values[100 / 32] ^= UINT32_C(1) << (100 % 32);
+    alarm_overview.values(alarm_values);
+    f = render();
+    report("one alarm", f);
+    const srect16 b = alarm_overview.bounds();
+    TEST_ASSERT_GREATER_THAN(0, f.rects);
+    TEST_ASSERT_LESS_THAN((size_t)(b.width() * b.height() * 2), f.bytes);
+    // every alarm changed
+    for (uint32_t& value : alarm_values) {
+        value = ~value;
+    }
+    alarm_overview.values(alarm_values);
+    f = render();
+    report("all alarms", f);
+    // the next page
+    switch_index = switches_count;
+    update_switches();
+    f = render();
+    report("page", f);
+    TEST_ASSERT_GREATER_THAN(0, f.rects);
+    switch_index = 0;
+    update_switches();
+    render();
+}
+static void test_touch(void) {
+    lcd.active_screen(main_screen);
+    render();
+    const size_t presses = reset_presses;
+    const srect16 b = reset_all.bounds();
+    touch_location = point16(b.x1 + b.width() / 2, b.y1 + b.height() / 2);
+    touch_count = 1;
+    frame f = render();
+    report("reset press", f);
+    TEST_ASSERT_EQUAL(presses + 1, reset_presses);
+    TEST_ASSERT_TRUE(reset_all.pressed());
+    TEST_ASSERT_GREATER_THAN(0, f.rects);
+    touch_count = 0;
+    f = render();
+    report("reset release", f);
+    TEST_ASSERT_FALSE(reset_all.pressed());
+    // paging through the right arrow
+    const srect16 a = right_button.bounds();
+    touch_location = point16(a.x1 + a.width() / 2, a.y1 + a.height() / 2);
+    touch_count = 1;
+    f = render();
+    report("arrow press", f);
+    TEST_ASSERT_EQUAL(switches_count, switch_index);
+    touch_count = 0;
+    f = render();
+    report("arrow release", f);
+    switch_index = 0;
+    update_switches();
+    render();
+}
+static void test_qr_screen(void) {
+    lcd.active_screen(qr_screen);
+    frame f = render();
+    report("QR screen", f);
+    TEST_ASSERT_GREATER_OR_EQUAL(screen_bytes, f.bytes);
+    TEST_ASSERT_NOT_EQUAL(0, lcd_pixel(qr_return.bounds()));
+    f = paint("QR code", qr_link);
+    TEST_ASSERT_LESS_THAN(screen_bytes, f.bytes);
+    f = paint("return button", qr_return);
+    TEST_ASSERT_LESS_THAN(screen_bytes, f.bytes);
+    qr_link.text("http://192.168.100.101");
+    f = render();
+    report("QR change", f);
+    TEST_ASSERT_GREATER_THAN(0, f.rects);
+}
+
+int main(int argc, char** argv) {
+    ui_init();
+    UNITY_BEGIN();
+    RUN_TEST(test_main_screen);
+    RUN_TEST(test_state_changes);
+    RUN_TEST(test_touch);
+    RUN_TEST(test_qr_screen);
+    return UNITY_END();
+}
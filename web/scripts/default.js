@@ -1,48 +1,89 @@
 var timerId = null;
+var events = null;
+// how long to poll before trying the event stream again. it doubles each
+// time the panel turns us away, so a busy panel isn't hammered
+var retryMs = 2000;
+var retryId = null;
+function applySwitches(alarms) {
+    for(var i = 0;i<alarms.status.length;++i) {
+        const id = "a"+i;
+        const cb = document.getElementById(id);
+        cb.checked = alarms.status[i];
+    }
+}
+function startPolling() {
+    if(events == null) {
+        timerId = setInterval(refreshSwitches,500);
+    }
+}
+function stopPolling() {
+    if(!(timerId == null)) {
+        clearInterval(timerId);
+        timerId = null;
+    }
+}
+function retryEvents() {
+    if(retryId == null) {
+        retryId = setTimeout(() => {
+            retryId = null;
+            startEvents();
+        },retryMs);
+        retryMs = Math.min(retryMs*2,60000);
+    }
+}
+function startEvents() {
+    if(!window.EventSource) {
+        return false;
+    }
+    events = new EventSource("./api/events");
+    events.onopen = () => {
+        // we're being pushed to again, so stop asking
+        retryMs = 2000;
+        stopPolling();
+    };
+    events.onmessage = (e) => applySwitches(JSON.parse(e.data));
+    events.onerror = () => {
+        // the panel went away or refused us. poll for a while, then try
+        // the stream again
+        events.close();
+        events = null;
+        if(timerId == null) {
+            startPolling();
+        }
+        retryEvents();
+    };
+    return true;
+}
+function initialize() {
+    if(!startEvents()) {
+        refreshSwitches();
+    }
+}
 function resetAll() {
     if(!(timerId == null)) {
         clearInterval(timerId);
+        timerId = null;
     }
-    
+
     fetch("./api?set")
     .then(response => response.json())
-    .then(alarms => {
-        for(var i = 0;i<alarms.status.length;++i) {
-            const id = "a"+i;
-            const cb = document.getElementById(id);
-            cb.checked = alarms.status[i];
-        }
-    })
+    .then(alarms => applySwitches(alarms))
     .catch(error => console.error("Error fetching JSON data:", error));
-    timerId = setInterval(refreshSwitches,500);
+    startPolling();
 }
 function refreshSwitches(write) {
     var url = "./api/";
     if(!(timerId == null)) {
         clearInterval(timerId);
+        timerId = null;
     }
-    if(write==true) {
-        url+="?set"
-        var cbs = document.getElementsByTagName("input");
-        for(var i = 0;i<cbs.length;++i) {
-            const id = "a"+i;
-            const cb = document.getElementById(id);
-            if(cb!=undefined) {
-                if(cb.checked) {
-                    url+=("&a="+i);
-                } 
-            }
-        }
+    if(write!=undefined && write.value!=undefined) {
+        // only send the one that changed. the whole set doesn't fit in a URL
+        url+=(write.checked?"?on=":"?off=")+write.value;
     }
     fetch(url)
         .then(response => response.json())
-        .then(alarms => {
-            for(var i = 0;i<alarms.status.length;++i) {
-                const id = "a"+i;
-                const cb = document.getElementById(id);
-                cb.checked = alarms.status[i];
-            }
-        })
+        .then(alarms => applySwitches(alarms))
         .catch(error => console.error("Error fetching JSON data:", error));
-    timerId = setInterval(refreshSwitches,500);
+    startPolling();
 }